@@ -4,11 +4,20 @@
 
 #include "common/file_io.h"
 
+#include <atomic>
+#include <cstdint>
+
+#include "absl/strings/str_cat.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 
 namespace crubit {
 
+static std::atomic<int64_t> skipped_file_writes = 0;
+
 absl::StatusOr<std::string> GetFileContents(absl::string_view path) {
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> err_or_buffer =
       llvm::MemoryBuffer::getFileOrSTDIN(path.data(), /* IsText= */ true);
@@ -19,19 +28,54 @@ absl::StatusOr<std::string> GetFileContents(absl::string_view path) {
   return std::string((*err_or_buffer)->getBuffer());
 }
 
+// Returns true if the file at `path` exists and has exactly the given
+// `contents`. The sizes are compared first, so that files that obviously
+// differ are not read at all; otherwise the file is mmap-ed (for files that
+// are big enough for it to pay off) and compared byte-by-byte.
+static bool HasFileContents(llvm::StringRef path, absl::string_view contents) {
+  uint64_t size;
+  if (llvm::sys::fs::file_size(path, size) || size != contents.size()) {
+    return false;
+  }
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> err_or_buffer =
+      llvm::MemoryBuffer::getFile(path, /* IsText= */ false,
+                                  /* RequiresNullTerminator= */ false);
+  if (!err_or_buffer) {
+    return false;
+  }
+  return (*err_or_buffer)->getBuffer() == llvm::StringRef(contents);
+}
+
 absl::Status SetFileContents(absl::string_view path,
                              absl::string_view contents) {
-  std::error_code error_code;
-  llvm::raw_fd_ostream stream(path, error_code);
-  if (error_code) {
+  llvm::TimeTraceScope time_trace("SetFileContents", path);
+  if (HasFileContents(path, contents)) {
+    ++skipped_file_writes;
+    return absl::OkStatus();
+  }
+
+  // The temporary file is created next to `path`, so that it is on the same
+  // filesystem and can be renamed atomically.
+  int fd;
+  llvm::SmallString<128> temp_path;
+  if (std::error_code error_code = llvm::sys::fs::createUniqueFile(
+          absl::StrCat(path, "-%%%%%%%%.tmp"), fd, temp_path)) {
     return absl::Status(absl::StatusCode::kInternal, error_code.message());
   }
+  llvm::raw_fd_ostream stream(fd, /* shouldClose= */ true);
   stream << contents;
   stream.close();
   if (stream.has_error()) {
+    llvm::sys::fs::remove(temp_path);
     return absl::Status(absl::StatusCode::kInternal, stream.error().message());
   }
+  if (std::error_code error_code = llvm::sys::fs::rename(temp_path, path)) {
+    llvm::sys::fs::remove(temp_path);
+    return absl::Status(absl::StatusCode::kInternal, error_code.message());
+  }
   return absl::OkStatus();
 }
 
+int64_t GetSkippedFileWritesCount() { return skipped_file_writes; }
+
 }  // namespace crubit
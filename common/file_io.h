@@ -5,6 +5,7 @@
 #ifndef CRUBIT_COMMON_FILE_IO_H_
 #define CRUBIT_COMMON_FILE_IO_H_
 
+#include <cstdint>
 #include <string>
 
 #include "absl/status/statusor.h"
@@ -13,9 +14,20 @@ namespace crubit {
 
 absl::StatusOr<std::string> GetFileContents(absl::string_view path);
 
+// Writes `contents` into the file at `path`.
+//
+// If the file already has exactly the given `contents`, then it is left
+// untouched (so that its modification time doesn't change and build systems
+// don't rebuild its dependents). Otherwise the contents are written into a
+// temporary file in the same directory, which is then atomically renamed to
+// `path` (so that readers never observe a partially written file).
 absl::Status SetFileContents(absl::string_view path,
                              absl::string_view contents);
 
+// Returns how many times `SetFileContents` skipped writing a file because it
+// already had the requested contents.
+int64_t GetSkippedFileWritesCount();
+
 }  // namespace crubit
 
 #endif  // CRUBIT_COMMON_FILE_IO_H_
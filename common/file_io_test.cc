@@ -0,0 +1,87 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "common/file_io.h"
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "common/status_test_matchers.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+
+namespace crubit {
+namespace {
+
+using ::testing::ElementsAre;
+
+std::string MakeTmpdirForCurrentTest() {
+  std::string path = absl::StrCat(
+      testing::TempDir(), "/",
+      testing::UnitTest::GetInstance()->current_test_info()->name());
+  EXPECT_FALSE(llvm::sys::fs::create_directories(path));
+  return path;
+}
+
+std::vector<std::string> ListDirectory(absl::string_view path) {
+  std::vector<std::string> result;
+  std::error_code error_code;
+  for (llvm::sys::fs::directory_iterator it(path, error_code), end;
+       it != end && !error_code; it.increment(error_code)) {
+    result.push_back(std::string(llvm::sys::path::filename(it->path())));
+  }
+  EXPECT_FALSE(error_code);
+  return result;
+}
+
+TEST(FileIoTest, SetFileContentsCreatesFile) {
+  std::string dir = MakeTmpdirForCurrentTest();
+  std::string path = absl::StrCat(dir, "/file.txt");
+  ASSERT_OK(SetFileContents(path, "contents"));
+  EXPECT_THAT(GetFileContents(path), IsOkAndHolds("contents"));
+  EXPECT_THAT(ListDirectory(dir), ElementsAre("file.txt"));
+}
+
+TEST(FileIoTest, SetFileContentsSkipsIdenticalContents) {
+  std::string dir = MakeTmpdirForCurrentTest();
+  std::string path = absl::StrCat(dir, "/file.txt");
+  ASSERT_OK(SetFileContents(path, "contents"));
+  int64_t skipped_file_writes = GetSkippedFileWritesCount();
+
+  ASSERT_OK(SetFileContents(path, "contents"));
+  EXPECT_EQ(GetSkippedFileWritesCount(), skipped_file_writes + 1);
+  EXPECT_THAT(GetFileContents(path), IsOkAndHolds("contents"));
+}
+
+TEST(FileIoTest, SetFileContentsReplacesChangedContents) {
+  std::string dir = MakeTmpdirForCurrentTest();
+  std::string path = absl::StrCat(dir, "/file.txt");
+  ASSERT_OK(SetFileContents(path, "contents"));
+  int64_t skipped_file_writes = GetSkippedFileWritesCount();
+
+  // Same size, different contents.
+  ASSERT_OK(SetFileContents(path, "CONTENTS"));
+  EXPECT_THAT(GetFileContents(path), IsOkAndHolds("CONTENTS"));
+  // Different size.
+  ASSERT_OK(SetFileContents(path, "more contents"));
+  EXPECT_THAT(GetFileContents(path), IsOkAndHolds("more contents"));
+
+  EXPECT_EQ(GetSkippedFileWritesCount(), skipped_file_writes);
+  EXPECT_THAT(ListDirectory(dir), ElementsAre("file.txt"));
+}
+
+TEST(FileIoTest, SetFileContentsReportsErrors) {
+  std::string dir = MakeTmpdirForCurrentTest();
+  EXPECT_FALSE(
+      SetFileContents(absl::StrCat(dir, "/no_such_dir/file.txt"), "").ok());
+  EXPECT_THAT(ListDirectory(dir), ElementsAre());
+}
+
+}  // namespace
+}  // namespace crubit
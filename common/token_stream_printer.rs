@@ -80,6 +80,45 @@ pub fn rs_tokens_to_formatted_string(
     rustfmt(tokens_to_string(tokens)?, config)
 }
 
+/// Like `rs_tokens_to_formatted_string`, but formats multiple independent
+/// token streams, running at most `max_concurrent_rustfmt` instances of
+/// `rustfmt` at the same time.  The results are returned in the same order as
+/// the inputs.
+pub fn rs_tokens_to_formatted_strings(
+    tokens: Vec<TokenStream>,
+    config: &RustfmtConfig,
+    max_concurrent_rustfmt: usize,
+) -> Result<Vec<String>> {
+    // `TokenStream` is not `Send`, so the token streams are printed on the
+    // current thread and only the `rustfmt` subprocesses run concurrently.
+    let inputs = tokens.into_iter().map(tokens_to_string).collect::<Result<Vec<_>>>()?;
+    let thread_count = max_concurrent_rustfmt.clamp(1, inputs.len().max(1));
+    let mut inputs_per_thread: Vec<Vec<(usize, String)>> = vec![vec![]; thread_count];
+    for (index, input) in inputs.into_iter().enumerate() {
+        inputs_per_thread[index % thread_count].push((index, input));
+    }
+    let mut outputs: Vec<(usize, String)> = std::thread::scope(|scope| {
+        let threads = inputs_per_thread
+            .into_iter()
+            .map(|inputs| {
+                scope.spawn(move || {
+                    inputs
+                        .into_iter()
+                        .map(|(index, input)| Ok((index, rustfmt(input, config)?)))
+                        .collect::<Result<Vec<_>>>()
+                })
+            })
+            .collect::<Vec<_>>();
+        let mut outputs = vec![];
+        for thread in threads {
+            outputs.extend(thread.join().expect("rustfmt thread panicked")?);
+        }
+        Ok::<_, anyhow::Error>(outputs)
+    })?;
+    outputs.sort_by_key(|(index, _)| *index);
+    Ok(outputs.into_iter().map(|(_, output)| output).collect())
+}
+
 /// Like `rs_tokens_to_formatted_string`, but always using a Crubit-internal,
 /// default rustfmt config.  This should only be called by tests - product code
 /// should support custom `rustfmt.toml` and take the path to `rustfmt` binary
@@ -96,6 +135,31 @@ pub fn cc_tokens_to_formatted_string(
     clang_format(tokens_to_string(tokens)?, clang_format_exe_path)
 }
 
+/// Equivalent to calling both `rs_tokens_to_formatted_string` and
+/// `cc_tokens_to_formatted_string`, except that `rustfmt` and `clang-format`
+/// run concurrently.  The wall time is therefore bounded by the slower of the
+/// two formatters rather than by their sum.
+///
+/// Exactly one extra thread is spawned for the duration of the call (on top
+/// of the stdin writer threads used by each formatter subprocess).
+pub fn rs_and_cc_tokens_to_formatted_strings(
+    rs_tokens: TokenStream,
+    rustfmt_config: &RustfmtConfig,
+    cc_tokens: TokenStream,
+    clang_format_exe_path: &Path,
+) -> Result<(String, String)> {
+    // `TokenStream` is not `Send`, so the token streams are printed on the
+    // current thread and only the formatter subprocesses run concurrently.
+    let rs_input = tokens_to_string(rs_tokens)?;
+    let cc_input = tokens_to_string(cc_tokens)?;
+    std::thread::scope(|scope| {
+        let rs_thread = scope.spawn(|| rustfmt(rs_input, rustfmt_config));
+        let cc_output = clang_format(cc_input, clang_format_exe_path);
+        let rs_output = rs_thread.join().expect("rustfmt thread panicked");
+        Ok((rs_output?, cc_output?))
+    })
+}
+
 /// Like `cc_tokens_to_formatted_string`, but always using a hardcoded path to
 /// where the `clang-format` binary is in Crubit's test environment.  This
 /// should only be called by tests - product code should take the path to the
@@ -446,6 +510,48 @@ fn foo(
         Ok(())
     }
 
+    #[test]
+    fn test_rs_tokens_to_formatted_strings() {
+        let cfg = RustfmtConfig::new(Path::new(RUSTFMT_EXE_PATH_FOR_TESTING), None);
+        let inputs = vec![quote! { fn a() {} }, quote! { fn b() {} }, quote! { fn c() {} }];
+        let outputs = rs_tokens_to_formatted_strings(inputs, &cfg, 2).unwrap();
+        assert_eq!(outputs, ["fn a() {}\n", "fn b() {}\n", "fn c() {}\n"]);
+        assert!(rs_tokens_to_formatted_strings(vec![], &cfg, 2).unwrap().is_empty());
+    }
+
+    #[test]
+    fn test_rs_and_cc_tokens_to_formatted_strings() {
+        let cfg = RustfmtConfig::new(Path::new(RUSTFMT_EXE_PATH_FOR_TESTING), None);
+        let rs_input = quote! {
+            fn foo(x: i32, y: i32) -> i32 { x + y }
+        };
+        let cc_input = quote! {
+            namespace ns {
+            void foo() {}
+            }
+        };
+        let (rs_output, cc_output) = rs_and_cc_tokens_to_formatted_strings(
+            rs_input,
+            &cfg,
+            cc_input,
+            Path::new(CLANG_FORMAT_EXE_PATH_FOR_TESTING),
+        )
+        .unwrap();
+        assert_eq!(
+            rs_output,
+            r#"fn foo(x: i32, y: i32) -> i32 {
+    x + y
+}
+"#
+        );
+        assert_eq!(
+            cc_output,
+            r#"namespace ns {
+void foo() {}
+}  // namespace ns"#
+        );
+    }
+
     #[test]
     fn test_cc_tokens_to_formatted_string_for_tests() {
         let input = quote! {
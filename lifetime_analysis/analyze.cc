@@ -5,6 +5,7 @@
 #include "lifetime_analysis/analyze.h"
 
 #include <algorithm>
+#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
@@ -17,6 +18,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_replace.h"
+#include "lifetime_analysis/function_summary_store.h"
 #include "lifetime_analysis/lifetime_analysis.h"
 #include "lifetime_analysis/lifetime_lattice.h"
 #include "lifetime_analysis/object_repository.h"
@@ -31,9 +33,8 @@
 #include "clang/AST/DeclTemplate.h"
 #include "clang/AST/Expr.h"
 #include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/AST/Type.h"
-#include "clang/ASTMatchers/ASTMatchFinder.h"
-#include "clang/ASTMatchers/ASTMatchers.h"
 #include "clang/Analysis/CFG.h"
 #include "clang/Analysis/FlowSensitive/ControlFlowContext.h"
 #include "clang/Analysis/FlowSensitive/DataflowAnalysis.h"
@@ -42,9 +43,13 @@
 #include "clang/Index/USRGeneration.h"
 #include "clang/Lex/Lexer.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/SHA256.h"
 
 namespace clang {
 namespace tidy {
@@ -365,7 +370,8 @@ std::string CreateCfgDot(
 // initialization itself.
 void ExtendPointsToMapAndConstraintsWithInitializers(
     const clang::CXXConstructorDecl *constructor,
-    const ObjectRepository &object_repository, PointsToMap &points_to_map,
+    const ObjectRepository &object_repository,
+    const ExprObjectMap &expr_objects, PointsToMap &points_to_map,
     LifetimeConstraints &constraints) {
   auto this_object = object_repository.GetThisObject();
   if (!this_object.has_value()) {
@@ -384,7 +390,8 @@ void ExtendPointsToMapAndConstraintsWithInitializers(
       TransferInitializer(
           object_repository.GetFieldObject(this_object.value(), field),
           field->getType(), object_repository, init_expr,
-          TargetPointeeBehavior::kKeep, points_to_map, constraints);
+          TargetPointeeBehavior::kKeep, expr_objects, points_to_map,
+          constraints);
     }
   }
 }
@@ -519,29 +526,102 @@ llvm::Error AnalyzeDefaultedFunction(
                                  "unsupported type of defaulted function");
 }
 
+// State that is shared by the dataflow analyses of all functions that are
+// analyzed together, usually those of one translation unit.
+// The control-flow context of a function is built the first time the function
+// is analyzed and reused when it is analyzed again, i.e. while iterating over
+// a recursive cycle or during an overrides traversal. It is released as soon as
+// the result for the function is final, so that only the contexts of the
+// current cycle or override group are kept.
+class DataflowSession {
+public:
+  explicit DataflowSession(const AnalysisBudget &budget)
+      : analysis_context_(
+            std::make_unique<clang::dataflow::WatchedLiteralsSolver>()),
+        initial_environment_(analysis_context_), budget_(budget) {}
+
+  DataflowSession(const DataflowSession &) = delete;
+  DataflowSession &operator=(const DataflowSession &) = delete;
+
+  // Returns the control-flow context for the body of `func`, building it if
+  // it doesn't exist yet.
+  llvm::Expected<const clang::dataflow::ControlFlowContext *>
+  GetControlFlowContext(const clang::FunctionDecl *func) {
+    auto iter = control_flow_contexts_.find(func);
+    if (iter != control_flow_contexts_.end())
+      return iter->second.get();
+
+    auto cfctx = clang::dataflow::ControlFlowContext::build(
+        func, *func->getBody(), func->getASTContext());
+    if (!cfctx)
+      return cfctx.takeError();
+    auto &entry = control_flow_contexts_[func];
+    entry = std::make_unique<clang::dataflow::ControlFlowContext>(
+        std::move(*cfctx));
+    return entry.get();
+  }
+
+  // Releases the control-flow context of `func`, whose result is final.
+  void ReleaseControlFlowContext(const clang::FunctionDecl *func) {
+    if (const clang::FunctionDecl *definition = func->getDefinition())
+      control_flow_contexts_.erase(definition);
+  }
+
+  // Releases the control-flow contexts of all functions.
+  void ReleaseControlFlowContexts() { control_flow_contexts_.clear(); }
+
+  // Returns the environment to start the analysis of a function with.
+  const clang::dataflow::Environment &InitialEnvironment() const {
+    return initial_environment_;
+  }
+
+  // Returns the limits on the analysis of each function.
+  const AnalysisBudget &Budget() const { return budget_; }
+
+  // Records whether the analysis of `func` was stopped because it exceeded
+  // the budget.
+  void SetExceededBudget(const clang::FunctionDecl *func, bool exceeded) {
+    if (exceeded)
+      exceeded_budget_.insert(func);
+    else
+      exceeded_budget_.erase(func);
+  }
+
+  // Returns whether the last analysis of `func` exceeded the budget.
+  bool ExceededBudget(const clang::FunctionDecl *func) const {
+    return exceeded_budget_.contains(func);
+  }
+
+private:
+  clang::dataflow::DataflowAnalysisContext analysis_context_;
+  clang::dataflow::Environment initial_environment_;
+  AnalysisBudget budget_;
+  llvm::DenseSet<const clang::FunctionDecl *> exceeded_budget_;
+  llvm::DenseMap<const clang::FunctionDecl *,
+                 std::unique_ptr<clang::dataflow::ControlFlowContext>>
+      control_flow_contexts_;
+};
+
 llvm::Error AnalyzeFunctionBody(
     const clang::FunctionDecl *func,
     const llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
         &callee_lifetimes,
     const DiagnosticReporter &diag_reporter,
     ObjectRepository &object_repository, PointsToMap &points_to_map,
-    LifetimeConstraints &constraints, std::string *cfg_dot) {
-  auto cfctx = clang::dataflow::ControlFlowContext::build(
-      func, *func->getBody(), func->getASTContext());
-  if (!cfctx)
-    return cfctx.takeError();
-
-  clang::dataflow::DataflowAnalysisContext analysis_context(
-      std::make_unique<clang::dataflow::WatchedLiteralsSolver>());
-  clang::dataflow::Environment environment(analysis_context);
+    LifetimeConstraints &constraints, std::string *cfg_dot,
+    DataflowSession &session) {
+  const clang::dataflow::ControlFlowContext *cfctx;
+  if (llvm::Error err = session.GetControlFlowContext(func).moveInto(cfctx))
+    return err;
 
   LifetimeAnalysis analysis(func, object_repository, callee_lifetimes,
-                            diag_reporter);
+                            diag_reporter, session.Budget());
 
   llvm::Expected<std::vector<
       llvm::Optional<clang::dataflow::DataflowAnalysisState<LifetimeLattice>>>>
-      maybe_block_to_output_state =
-          clang::dataflow::runDataflowAnalysis(*cfctx, analysis, environment);
+      maybe_block_to_output_state = clang::dataflow::runDataflowAnalysis(
+          *cfctx, analysis, session.InitialEnvironment());
+  session.SetExceededBudget(func, analysis.ExceededBudget());
   if (!maybe_block_to_output_state) {
     return maybe_block_to_output_state.takeError();
   }
@@ -576,7 +656,8 @@ llvm::Error AnalyzeFunctionBody(
   // afterwards is correct.
   if (auto *constructor = clang::dyn_cast<clang::CXXConstructorDecl>(func)) {
     ExtendPointsToMapAndConstraintsWithInitializers(
-        constructor, object_repository, points_to_map, constraints);
+        constructor, object_repository, analysis.ExprObjects(), points_to_map,
+        constraints);
   }
 
   // Extend the constraint set with constraints of the form "'a >= 'static" for
@@ -609,7 +690,8 @@ llvm::Expected<FunctionAnalysis> AnalyzeSingleFunction(
     const clang::FunctionDecl *func,
     const llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
         &callee_lifetimes,
-    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info) {
+    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
+    DataflowSession &session) {
   FunctionAnalysis analysis{.object_repository = ObjectRepository(func)};
 
   const auto *cxxmethod = clang::dyn_cast<clang::CXXMethodDecl>(func);
@@ -647,7 +729,7 @@ llvm::Expected<FunctionAnalysis> AnalyzeSingleFunction(
     std::string *cfg_dot = debug_info ? &(*debug_info)[func].cfg_dot : nullptr;
     if (llvm::Error err = AnalyzeFunctionBody(
             func, callee_lifetimes, diag_reporter, analysis.object_repository,
-            analysis.points_to_map, analysis.constraints, cfg_dot)) {
+            analysis.points_to_map, analysis.constraints, cfg_dot, session)) {
       return std::move(err);
     }
   } else {
@@ -790,140 +872,267 @@ GetDefaultedFunctionCallees(const clang::FunctionDecl *func) {
                                  "unsupported type of defaulted function");
 }
 
-llvm::Expected<llvm::DenseSet<const clang::FunctionDecl *>>
-GetCallees(const clang::FunctionDecl *func) {
-  using clang::ast_matchers::anyOf;
-  using clang::ast_matchers::cxxConstructExpr;
-  using clang::ast_matchers::declRefExpr;
-  using clang::ast_matchers::expr;
-  using clang::ast_matchers::findAll;
-  using clang::ast_matchers::functionDecl;
-  using clang::ast_matchers::hasDeclaration;
-  using clang::ast_matchers::match;
-  using clang::ast_matchers::memberExpr;
-  using clang::ast_matchers::to;
-
-  func = func->getDefinition();
+// The function definitions in a translation unit, the functions they reference
+// and the overrides of virtual methods, collected in a single traversal of the
+// AST.
+class CallGraph {
+public:
+  // Returns an empty call graph. Callees are collected on demand by
+  // `GetCallees()`.
+  CallGraph() = default;
+
+  // Returns the call graph of all function definitions in `tu`.
+  static CallGraph ForTranslationUnit(const clang::TranslationUnitDecl *tu);
+
+  // All function definitions with a body, in the order in which they appear in
+  // the AST.
+  llvm::ArrayRef<const clang::FunctionDecl *> Definitions() const {
+    return definitions_;
+  }
+
+  // Returns the canonical declarations of the functions referenced from the
+  // body and the constructor initializers of the definition of `func`.
+  llvm::Expected<llvm::DenseSet<const clang::FunctionDecl *>>
+  GetCallees(const clang::FunctionDecl *func);
+
+  // Returns the overrides of `method` (a canonical declaration) among the
+  // definitions in the call graph, or null if there are none.
+  const llvm::SmallPtrSet<const clang::CXXMethodDecl *, 2> *
+  GetOverrides(const clang::CXXMethodDecl *method) const {
+    auto iter = base_to_overrides_.find(method);
+    return iter == base_to_overrides_.end() ? nullptr : &iter->second;
+  }
+
+private:
+  class Builder;
+
+  llvm::SmallVector<const clang::FunctionDecl *> definitions_;
+  llvm::DenseMap<const clang::FunctionDecl *,
+                 llvm::DenseSet<const clang::FunctionDecl *>>
+      callees_;
+  BaseToOverrides base_to_overrides_;
+};
 
-  if (!func)
-    return llvm::DenseSet<const clang::FunctionDecl *>();
+// Records the definitions visited in the traversal, and the functions
+// referenced from each of them, in a `CallGraph`.
+class CallGraph::Builder : public clang::RecursiveASTVisitor<Builder> {
+public:
+  // If `add_definitions` is false, the definitions visited are not added to
+  // `CallGraph::Definitions()`, which may be iterated over while we traverse.
+  Builder(CallGraph &call_graph, bool add_definitions)
+      : call_graph_(call_graph), add_definitions_(add_definitions) {}
+
+  // We need to visit implicitly-defined constructors and assignment operators,
+  // as well as template instantiations.
+  bool shouldVisitImplicitCode() const { return true; }
+  bool shouldVisitTemplateInstantiations() const { return true; }
+
+  bool TraverseDecl(clang::Decl *decl) {
+    auto *func = clang::dyn_cast_or_null<clang::FunctionDecl>(decl);
+    // For now we skip functions that don't have a body and are not called.
+    // TODO(veluca): a function might be used in other ways.
+    if (!func || !func->isThisDeclarationADefinition() ||
+        !func->doesThisDeclarationHaveABody()) {
+      return RecursiveASTVisitor::TraverseDecl(decl);
+    }
+    AddDefinition(func);
+    enclosing_.push_back({.func = func, .in_body = false});
+    bool result = RecursiveASTVisitor::TraverseDecl(decl);
+    enclosing_.pop_back();
+    return result;
+  }
 
-  const clang::Stmt *body = func->getBody();
-  if (!body) {
-    // TODO(b/230693710): Do this unconditionally for defaulted functions, even
-    // if they happen to have a body (because something caused Sema to create a
-    // body for them). We can't do this yet because we don't have full support
-    // for defaulted functions yet, so we would break tests where we happen to
-    // have a body for the defaulted function today.
-    if (func->isDefaulted()) {
-      return GetDefaultedFunctionCallees(func);
+  bool TraverseStmt(clang::Stmt *stmt, DataRecursionQueue *queue = nullptr) {
+    if (enclosing_.empty() || enclosing_.back().in_body ||
+        stmt != enclosing_.back().func->getBody()) {
+      return RecursiveASTVisitor::TraverseStmt(stmt, queue);
     }
+    return TraverseInBody([&] {
+      // Traverse the body without a queue so that all of it is traversed
+      // before we leave it.
+      return RecursiveASTVisitor::TraverseStmt(stmt);
+    });
+  }
 
-    return llvm::createStringError(llvm::inconvertibleErrorCode(),
-                                   "Declaration-only!");
+  bool TraverseConstructorInitializer(clang::CXXCtorInitializer *init) {
+    if (enclosing_.empty() || enclosing_.back().in_body) {
+      return RecursiveASTVisitor::TraverseConstructorInitializer(init);
+    }
+    return TraverseInBody([&] {
+      return RecursiveASTVisitor::TraverseConstructorInitializer(init);
+    });
   }
 
-  llvm::SmallVector<const clang::Stmt *> body_parts;
+  bool VisitDeclRefExpr(clang::DeclRefExpr *decl_ref) {
+    if (const auto *func =
+            clang::dyn_cast<clang::FunctionDecl>(decl_ref->getDecl())) {
+      AddCallee(func);
+    }
+    return true;
+  }
 
-  body_parts.push_back(body);
+  bool VisitMemberExpr(clang::MemberExpr *member) {
+    if (const auto *func =
+            clang::dyn_cast<clang::FunctionDecl>(member->getMemberDecl())) {
+      AddCallee(func);
+    }
+    return true;
+  }
 
-  if (const auto *constructor =
-          clang::dyn_cast<clang::CXXConstructorDecl>(func)) {
-    for (const auto *init : constructor->inits()) {
-      body_parts.push_back(init->getInit());
+  bool VisitCXXConstructExpr(clang::CXXConstructExpr *construct_expr) {
+    if (const clang::CXXConstructorDecl *ctor =
+            construct_expr->getConstructor()) {
+      AddCallee(ctor);
     }
+    return true;
   }
 
-  llvm::DenseSet<const clang::FunctionDecl *> callees;
-  for (const auto &body_part : body_parts) {
-    for (const auto &node : match(
-             findAll(expr(anyOf(
-                 declRefExpr(to(functionDecl().bind("function"))),
-                 memberExpr(hasDeclaration(functionDecl().bind("function")))))),
-             *body_part, func->getASTContext())) {
-      const auto *fn = node.getNodeAs<clang::FunctionDecl>("function");
-      callees.insert(fn->getCanonicalDecl());
+private:
+  struct EnclosingFunction {
+    const clang::FunctionDecl *func;
+    // Whether we are in the body or the constructor initializers of `func`
+    // (as opposed to, say, the default arguments of its parameters).
+    bool in_body;
+  };
+
+  void AddDefinition(const clang::FunctionDecl *func) {
+    if (!call_graph_.callees_.try_emplace(func->getCanonicalDecl()).second) {
+      return;
     }
-    for (const auto &node :
-         match(findAll(cxxConstructExpr().bind("cxx_construct")), *body_part,
-               func->getASTContext())) {
-      const auto *ctor_exp =
-          node.getNodeAs<clang::CXXConstructExpr>("cxx_construct");
-      if (auto ctor = ctor_exp->getConstructor()) {
-        callees.insert(ctor);
-      }
+    if (add_definitions_) {
+      call_graph_.definitions_.push_back(func);
+    }
+
+    const auto *method = clang::dyn_cast<clang::CXXMethodDecl>(func);
+    if (!method || !method->isVirtual()) {
+      return;
+    }
+    method = method->getCanonicalDecl();
+    for (const auto *base : method->overridden_methods()) {
+      call_graph_.base_to_overrides_[base->getCanonicalDecl()].insert(method);
     }
   }
 
-  return std::move(callees);
-}
+  template <typename TraverseFn> bool TraverseInBody(TraverseFn traverse) {
+    enclosing_.back().in_body = true;
+    bool result = traverse();
+    enclosing_.back().in_body = false;
+    return result;
+  }
 
-// Looks for `func` in the `visited_call_stack`. If found it marks `func` and
-// each function that came after it as being part of the cycle. This marking is
-// stored in the `VisitedCallStackEntry`.
-bool FindAndMarkCycleWithFunc(
-    llvm::SmallVectorImpl<VisitedCallStackEntry> &visited_call_stack,
-    const clang::FunctionDecl *func) {
-  // We look for recursive cycles in a simple (but potentially slow for huge
-  // call graphs) way. If we reach a function that is already on the call stack
-  // (i.e. in `visited`), we declare `func`, and every other function after
-  // where `func` was seen in `visited` as being part of a cycle. Then a cycle
-  // graph is a contiguous set of functions in the `visited` call stack that are
-  // marked as being in a cycle.
-  bool found_cycle = false;
-  for (size_t i = visited_call_stack.size(); i > 0; --i) {
-    const auto &stack_entry = visited_call_stack[i - 1];
-    if (stack_entry.func == func) {
-      found_cycle = true;
-      for (; i <= visited_call_stack.size(); ++i) {
-        auto &mut_stack_entry = visited_call_stack[i - 1];
-        mut_stack_entry.in_cycle = true;
+  // A function referenced from a nested function (such as a lambda or a method
+  // of a local class) is also a callee of all the functions around it.
+  void AddCallee(const clang::FunctionDecl *callee) {
+    callee = callee->getCanonicalDecl();
+    for (const EnclosingFunction &enclosing : enclosing_) {
+      if (enclosing.in_body) {
+        call_graph_.callees_[enclosing.func->getCanonicalDecl()].insert(callee);
       }
-      break;
     }
   }
-  return found_cycle;
+
+  CallGraph &call_graph_;
+  bool add_definitions_;
+  llvm::SmallVector<EnclosingFunction> enclosing_;
+};
+
+CallGraph CallGraph::ForTranslationUnit(const clang::TranslationUnitDecl *tu) {
+  CallGraph call_graph;
+  Builder(call_graph, /*add_definitions=*/true)
+      .TraverseDecl(const_cast<clang::TranslationUnitDecl *>(tu));
+  return call_graph;
 }
 
-llvm::SmallVector<const clang::FunctionDecl *>
-GetAllFunctionDefinitions(const clang::TranslationUnitDecl *tu) {
-  using clang::ast_matchers::findAll;
-  using clang::ast_matchers::functionDecl;
-  using clang::ast_matchers::hasBody;
-  using clang::ast_matchers::isDefinition;
-  using clang::ast_matchers::match;
-  using clang::ast_matchers::stmt;
+llvm::Expected<llvm::DenseSet<const clang::FunctionDecl *>>
+CallGraph::GetCallees(const clang::FunctionDecl *func) {
+  auto iter = callees_.find(func->getCanonicalDecl());
+  if (iter != callees_.end()) {
+    return iter->second;
+  }
+
+  func = func->getDefinition();
 
-  llvm::SmallVector<const clang::FunctionDecl *> functions;
+  if (!func)
+    return llvm::DenseSet<const clang::FunctionDecl *>();
 
-  // For now we specify 'hasBody' to skip functions that don't have a body and
-  // are not called. TODO(veluca): a function might be used in other ways.
-  for (const auto &node : match(
-           findAll(functionDecl(isDefinition(), hasBody(stmt())).bind("func")),
-           tu->getASTContext())) {
-    const auto *func = node.getNodeAs<clang::FunctionDecl>("func");
-    assert(func);
-    functions.push_back(func);
+  if (!func->getBody()) {
+    // TODO(b/230693710): Do this unconditionally for defaulted functions, even
+    // if they happen to have a body (because something caused Sema to create a
+    // body for them). We can't do this yet because we don't have full support
+    // for defaulted functions yet, so we would break tests where we happen to
+    // have a body for the defaulted function today.
+    if (func->isDefaulted()) {
+      return GetDefaultedFunctionCallees(func);
+    }
+
+    return llvm::createStringError(llvm::inconvertibleErrorCode(),
+                                   "Declaration-only!");
   }
 
-  return functions;
+  // `func` wasn't part of the traversal that built this call graph (or there
+  // was none, as in `AnalyzeFunction()`), so traverse it now. Any functions
+  // nested in it are added as well.
+  Builder(*this, /*add_definitions=*/false)
+      .TraverseDecl(const_cast<clang::FunctionDecl *>(func));
+  return callees_.lookup(func->getCanonicalDecl());
 }
 
-BaseToOverrides BuildBaseToOverrides(const clang::TranslationUnitDecl *tu) {
-  BaseToOverrides base_to_overrides;
-  for (const clang::FunctionDecl *f : GetAllFunctionDefinitions(tu)) {
-    auto *func = clang::dyn_cast<clang::CXXMethodDecl>(f);
-    if (!func)
-      continue;
-    func = func->getCanonicalDecl();
-    if (!func->isVirtual())
-      continue;
-    for (const auto *base : func->overridden_methods()) {
-      base_to_overrides[base->getCanonicalDecl()].insert(func);
+// The stack of functions whose analysis has started but not finished yet. In
+// addition to the functions on the current path through the call graph, this
+// contains functions that are part of a recursive cycle with a function further
+// down the stack; these stay on the stack until we get back to the entry point
+// of the cycle.
+class VisitedCallStack {
+public:
+  bool empty() const { return entries_.empty(); }
+  size_t size() const { return entries_.size(); }
+  VisitedCallStackEntry &operator[](size_t index) { return entries_[index]; }
+  VisitedCallStackEntry &back() { return entries_.back(); }
+
+  // Returns the entries from position `index` up to the top of the stack.
+  llvm::ArrayRef<VisitedCallStackEntry> EntriesFrom(size_t index) const {
+    return llvm::ArrayRef<VisitedCallStackEntry>(entries_).drop_front(index);
+  }
+
+  // Returns the position of the topmost entry for `func`, if there is one.
+  std::optional<size_t> Find(const clang::FunctionDecl *func) const {
+    auto iter = topmost_index_.find(func);
+    if (iter == topmost_index_.end())
+      return std::nullopt;
+    return iter->second;
+  }
+
+  void Push(const clang::FunctionDecl *func) {
+    // An overrides traversal may push a function that is already on the stack.
+    auto [iter, inserted] = topmost_index_.try_emplace(func, entries_.size());
+    previous_index_.push_back(inserted ? std::nullopt
+                                       : std::optional<size_t>(iter->second));
+    iter->second = entries_.size();
+    entries_.push_back(VisitedCallStackEntry{
+        .func = func, .in_cycle = false, .in_overrides_traversal = false});
+  }
+
+  // Removes the entries from position `index` up to the top of the stack.
+  void PopTo(size_t index) {
+    while (entries_.size() > index) {
+      const clang::FunctionDecl *func = entries_.back().func;
+      if (std::optional<size_t> previous = previous_index_.back()) {
+        topmost_index_[func] = *previous;
+      } else {
+        topmost_index_.erase(func);
+      }
+      entries_.pop_back();
+      previous_index_.pop_back();
     }
   }
-  return base_to_overrides;
-}
+
+private:
+  llvm::SmallVector<VisitedCallStackEntry> entries_;
+  // For each entry, the position of the entry for the same function below it,
+  // if there is one.
+  llvm::SmallVector<std::optional<size_t>> previous_index_;
+  llvm::DenseMap<const clang::FunctionDecl *, size_t> topmost_index_;
+};
 
 void GetBaseMethods(const clang::CXXMethodDecl *cxxmethod,
                     llvm::DenseSet<const clang::CXXMethodDecl *> &bases) {
@@ -1004,11 +1213,53 @@ llvm::Error UpdateFunctionLifetimesWithOverrides(
   return llvm::Error::success();
 }
 
+// Renames the lifetime variables in `func_lifetimes` to the lifetimes in
+// `canonical_lifetimes`, in the order in which the traversal first sees them,
+// adding lifetimes to `canonical_lifetimes` as needed. Once renamed this way,
+// two FunctionLifetimes for the same function are isomorphic if and only if
+// they contain the same lifetimes (see `HaveSameLifetimes()`).
+void CanonicalizeLifetimes(
+    FunctionLifetimes &func_lifetimes,
+    llvm::SmallVectorImpl<Lifetime> &canonical_lifetimes) {
+  llvm::DenseMap<Lifetime, Lifetime> renamed;
+  func_lifetimes.Traverse([&](Lifetime &lifetime, Variance) {
+    if (!lifetime.IsVariable())
+      return;
+    auto [iter, inserted] = renamed.try_emplace(lifetime);
+    if (inserted) {
+      if (renamed.size() > canonical_lifetimes.size()) {
+        canonical_lifetimes.push_back(Lifetime::CreateVariable());
+      }
+      iter->second = canonical_lifetimes[renamed.size() - 1];
+    }
+    lifetime = iter->second;
+  });
+}
+
+bool HaveSameLifetimes(const FunctionLifetimes &a, const FunctionLifetimes &b) {
+  llvm::SmallVector<Lifetime> a_lifetimes;
+  a.Traverse([&a_lifetimes](const Lifetime &lifetime, Variance) {
+    a_lifetimes.push_back(lifetime);
+  });
+  llvm::SmallVector<Lifetime> b_lifetimes;
+  b.Traverse([&b_lifetimes](const Lifetime &lifetime, Variance) {
+    b_lifetimes.push_back(lifetime);
+  });
+  return a_lifetimes == b_lifetimes;
+}
+
 llvm::Error AnalyzeRecursiveFunctions(
     llvm::ArrayRef<VisitedCallStackEntry> funcs,
     llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
         &analyzed,
-    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info) {
+    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
+    CallGraph &call_graph, DataflowSession &session) {
+  // The lifetimes that we reuse for each function in the cycle each time it is
+  // analyzed, so that we can tell whether its FunctionLifetimes changed with a
+  // cheap comparison.
+  llvm::DenseMap<const clang::FunctionDecl *, llvm::SmallVector<Lifetime>>
+      canonical_lifetimes;
+
   for (const auto [func, in_cycle, _] : funcs) {
     assert(in_cycle);
 
@@ -1024,9 +1275,28 @@ llvm::Error AnalyzeRecursiveFunctions(
     if (!func_lifetimes_result) {
       return func_lifetimes_result.takeError();
     }
+    CanonicalizeLifetimes(func_lifetimes_result.get(),
+                          canonical_lifetimes[func]);
     analyzed[func->getCanonicalDecl()] = func_lifetimes_result.get();
   }
 
+  // For each function in the cycle, the functions in the cycle that call it.
+  // These are the only functions whose analysis depends on its lifetimes.
+  llvm::DenseMap<const clang::FunctionDecl *,
+                 llvm::SmallVector<const clang::FunctionDecl *>>
+      callers_in_cycle;
+  for (const auto [caller, _1, _2] : funcs) {
+    auto callees = call_graph.GetCallees(caller);
+    if (!callees) {
+      return callees.takeError();
+    }
+    for (const clang::FunctionDecl *callee : callees.get()) {
+      if (canonical_lifetimes.count(callee)) {
+        callers_in_cycle[callee].push_back(caller);
+      }
+    }
+  }
+
   int64_t expected_iterations = 0;
   for (const auto [func, _1, _2] : funcs) {
     expected_iterations =
@@ -1035,13 +1305,23 @@ llvm::Error AnalyzeRecursiveFunctions(
   // Add 1 for the last iteration that sees nothing changed.
   expected_iterations += 1;
 
-  // Analyze all lifetimes in the cycle repeatedly with dataflow analysis
-  // until they stabilize.
-  bool func_lifetimes_changed = true;
-  for (int64_t count = 0; func_lifetimes_changed; ++count) {
-    func_lifetimes_changed = false;
+  // Analyze the functions in the cycle with dataflow analysis until their
+  // lifetimes stabilize. Initially every function needs to be analyzed; after
+  // that, a function only needs to be analyzed again if the lifetimes of one
+  // of its callees changed.
+  std::deque<const clang::FunctionDecl *> worklist;
+  llvm::DenseSet<const clang::FunctionDecl *> in_worklist;
+  for (const auto [func, _1, _2] : funcs) {
+    worklist.push_back(func);
+    in_worklist.insert(func);
+  }
+  llvm::DenseMap<const clang::FunctionDecl *, int64_t> iterations;
+  while (!worklist.empty()) {
+    const clang::FunctionDecl *func = worklist.front();
+    worklist.pop_front();
+    in_worklist.erase(func);
 
-    if (count > expected_iterations) {
+    if (++iterations[func] > expected_iterations + 1) {
       return llvm::createStringError(
           llvm::inconvertibleErrorCode(),
           absl::StrFormat("Recursive cycle requires more than the expected "
@@ -1049,46 +1329,375 @@ llvm::Error AnalyzeRecursiveFunctions(
                           expected_iterations));
     }
 
-    for (const auto [func, in_cycle, _] : funcs) {
-      auto analysis_result =
-          AnalyzeSingleFunction(func, analyzed, diag_reporter, debug_info);
-      if (!analysis_result) {
-        return analysis_result.takeError();
+    auto analysis_result = AnalyzeSingleFunction(func, analyzed, diag_reporter,
+                                                 debug_info, session);
+    if (!analysis_result) {
+      return analysis_result.takeError();
+    }
+    auto func_lifetimes_result = ConstructFunctionLifetimes(
+        func, std::move(analysis_result.get()), diag_reporter);
+    if (!func_lifetimes_result) {
+      return func_lifetimes_result.takeError();
+    }
+    CanonicalizeLifetimes(func_lifetimes_result.get(),
+                          canonical_lifetimes[func]);
+    FunctionLifetimesOrError &existing_result =
+        analyzed[func->getCanonicalDecl()];
+    if (std::holds_alternative<FunctionLifetimes>(existing_result) &&
+        !HaveSameLifetimes(std::get<FunctionLifetimes>(existing_result),
+                           func_lifetimes_result.get())) {
+      existing_result = func_lifetimes_result.get();
+      for (const clang::FunctionDecl *caller : callers_in_cycle[func]) {
+        if (in_worklist.insert(caller).second) {
+          worklist.push_back(caller);
+        }
       }
-      auto func_lifetimes_result = ConstructFunctionLifetimes(
-          func, std::move(analysis_result.get()), diag_reporter);
-      if (!func_lifetimes_result) {
-        return func_lifetimes_result.takeError();
+    }
+  }
+
+  return llvm::Error::success();
+}
+
+// The version of the summaries kept in a `FunctionSummaryStore`. Bump whenever
+// the analysis or the serialization of its results changes, so that summaries
+// computed by an older version are not reused.
+constexpr int kFunctionSummaryVersion = 2;
+
+// Returns whether lifetime elision is enabled in the file that declares
+// `func`.
+bool IsLifetimeElisionEnabled(
+    const clang::FunctionDecl *func,
+    const LifetimeAnnotationContext &lifetime_context) {
+  const clang::SourceManager &source_manager =
+      func->getASTContext().getSourceManager();
+  return lifetime_context.lifetime_elision_files.contains(
+      source_manager.getFileID(func->getSourceRange().getBegin()));
+}
+
+// Adds the records that `type` refers to to `records`, looking through
+// pointers, references, arrays and function types.
+void AddReachedRecords(clang::QualType type,
+                       llvm::SetVector<const clang::CXXRecordDecl *> &records) {
+  if (type.isNull()) {
+    return;
+  }
+  type = type.getCanonicalType();
+  if (type->isAnyPointerType() || type->isReferenceType() ||
+      type->isMemberPointerType()) {
+    AddReachedRecords(type->getPointeeType(), records);
+  } else if (const clang::ArrayType *array = type->getAsArrayTypeUnsafe()) {
+    AddReachedRecords(array->getElementType(), records);
+  } else if (const auto *func_type = type->getAs<clang::FunctionProtoType>()) {
+    AddReachedRecords(func_type->getReturnType(), records);
+    for (clang::QualType param_type : func_type->getParamTypes()) {
+      AddReachedRecords(param_type, records);
+    }
+  } else if (const clang::CXXRecordDecl *record = type->getAsCXXRecordDecl()) {
+    records.insert(record->getCanonicalDecl());
+  }
+}
+
+// Adds the type arguments in `args` (including those in packs) to `records`.
+void AddReachedRecords(llvm::ArrayRef<clang::TemplateArgument> args,
+                       llvm::SetVector<const clang::CXXRecordDecl *> &records) {
+  for (const clang::TemplateArgument &arg : args) {
+    if (arg.getKind() == clang::TemplateArgument::Type) {
+      AddReachedRecords(arg.getAsType(), records);
+    } else if (arg.getKind() == clang::TemplateArgument::Pack) {
+      AddReachedRecords(arg.pack_elements(), records);
+    }
+  }
+}
+
+// Collects the records whose types appear in the signature or the body of a
+// function.
+class ReachedRecordsCollector
+    : public clang::RecursiveASTVisitor<ReachedRecordsCollector> {
+public:
+  explicit ReachedRecordsCollector(
+      llvm::SetVector<const clang::CXXRecordDecl *> &records)
+      : records_(records) {}
+
+  bool shouldVisitImplicitCode() const { return true; }
+
+  bool VisitValueDecl(clang::ValueDecl *decl) {
+    AddReachedRecords(decl->getType(), records_);
+    return true;
+  }
+
+  bool VisitExpr(clang::Expr *expr) {
+    AddReachedRecords(expr->getType(), records_);
+    return true;
+  }
+
+private:
+  llvm::SetVector<const clang::CXXRecordDecl *> &records_;
+};
+
+// Appends the `annotate` attributes of `decl`, with their arguments, to
+// `digest`. These include the lifetime parameters of records and the lifetime
+// arguments of fields.
+void AppendAnnotations(const clang::Decl *decl, std::string &digest) {
+  for (const auto *annotate : decl->specific_attrs<clang::AnnotateAttr>()) {
+    absl::StrAppend(&digest, "[", annotate->getAnnotation().str());
+    for (const clang::Expr *arg : annotate->args()) {
+      llvm::Expected<llvm::StringRef> value =
+          EvaluateAsStringLiteral(arg, decl->getASTContext());
+      if (value) {
+        absl::StrAppend(&digest, ",", value->str());
+      } else {
+        llvm::consumeError(value.takeError());
+        absl::StrAppend(&digest, ",?");
+      }
+    }
+    absl::StrAppend(&digest, "]");
+  }
+}
+
+// Returns a digest of the definitions of the records that `definition` reaches
+// through its signature and body, and transitively through the fields, bases
+// and template arguments of those records.
+// The ODR hash of `definition` only refers to these records by name, and it
+// doesn't cover the lifetime annotations on them, so the analysis result may
+// change when one of these definitions does, even if `definition` doesn't.
+std::string GetReachedRecordsDigest(const clang::FunctionDecl *definition) {
+  llvm::SetVector<const clang::CXXRecordDecl *> records;
+  ReachedRecordsCollector(records).TraverseDecl(
+      const_cast<clang::FunctionDecl *>(definition));
+  if (const auto *method = clang::dyn_cast<clang::CXXMethodDecl>(definition)) {
+    records.insert(method->getParent()->getCanonicalDecl());
+  }
+
+  std::vector<std::string> record_digests;
+  // `records` grows while we iterate over it.
+  for (size_t i = 0; i < records.size(); ++i) {
+    std::string digest = clang::QualType(records[i]->getTypeForDecl(), 0)
+                             .getCanonicalType()
+                             .getAsString();
+    const clang::CXXRecordDecl *record = records[i]->getDefinition();
+    if (!record) {
+      record_digests.push_back(absl::StrCat(digest, "{incomplete}"));
+      continue;
+    }
+    absl::StrAppend(&digest, "{",
+                    const_cast<clang::CXXRecordDecl *>(record)->getODRHash());
+    AppendAnnotations(record, digest);
+    for (const clang::CXXBaseSpecifier &base : record->bases()) {
+      absl::StrAppend(&digest, ";base ",
+                      base.getType().getCanonicalType().getAsString());
+      AddReachedRecords(base.getType(), records);
+    }
+    for (const clang::FieldDecl *field : record->fields()) {
+      absl::StrAppend(&digest, ";", field->getNameAsString(), ":",
+                      field->getType().getCanonicalType().getAsString());
+      AppendAnnotations(field, digest);
+      AddReachedRecords(field->getType(), records);
+    }
+    if (const auto *specialization =
+            clang::dyn_cast<clang::ClassTemplateSpecializationDecl>(record)) {
+      AddReachedRecords(specialization->getTemplateArgs().asArray(), records);
+    }
+    absl::StrAppend(&digest, "}");
+    record_digests.push_back(std::move(digest));
+  }
+  std::sort(record_digests.begin(), record_digests.end());
+
+  return llvm::toHex(llvm::SHA256::hash(llvm::arrayRefFromStringRef(
+                         absl::StrJoin(record_digests, "\n"))),
+                     /*LowerCase=*/true);
+}
+
+// Returns the key under which the summary of `func` is kept in a
+// `FunctionSummaryStore`. The key consists of the summary version, the USR of
+// `func`, the ODR hash of its definition (which covers its body), the inputs
+// that affect the result but not the ODR hash (whether lifetime elision is
+// enabled for `func`, and the definitions and lifetime annotations of the
+// records it reaches), and the USRs and summaries of its callees. Returns
+// nullopt if `func` can't be summarized, e.g. because the analysis of one of
+// its callees failed.
+std::optional<std::string> GetFunctionSummaryKey(
+    const clang::FunctionDecl *func,
+    const llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
+        &analyzed,
+    const LifetimeAnnotationContext &lifetime_context,
+    CallGraph &call_graph) {
+  auto get_usr = [](const clang::Decl *decl) -> std::optional<std::string> {
+    llvm::SmallString</*inline size=*/128> usr;
+    if (clang::index::generateUSRForDecl(decl, usr)) {
+      return std::nullopt;
+    }
+    return std::string(usr.str());
+  };
+
+  std::optional<std::string> func_usr = get_usr(func);
+  const clang::FunctionDecl *definition = func->getDefinition();
+  if (!func_usr || !definition) {
+    return std::nullopt;
+  }
+
+  auto callees = call_graph.GetCallees(func);
+  if (!callees) {
+    llvm::consumeError(callees.takeError());
+    return std::nullopt;
+  }
+  std::vector<std::string> callee_summaries;
+  for (const clang::FunctionDecl *callee : callees.get()) {
+    std::optional<std::string> callee_usr = get_usr(callee);
+    if (!callee_usr) {
+      return std::nullopt;
+    }
+    // Callees without a result (such as builtins) are identified by their USR
+    // and by whether lifetime elision applies to their declaration.
+    std::string summary;
+    if (auto iter = analyzed.find(callee); iter != analyzed.end()) {
+      const auto *lifetimes = std::get_if<FunctionLifetimes>(&iter->second);
+      if (!lifetimes) {
+        return std::nullopt;
       }
-      // TODO(danakj): We can avoid this structural comparison and just do a
-      // check for equality if AnalyzeSingleFunction would reuse Lifetimes
-      // from the existing FunctionLifetime for its parameters/return/this.
-      // Currently it makes a new set of Lifetimes each time we do the analyze
-      // step, but the actual Lifetime ids aren't meaningful, only where and
-      // how often a given Lifetime repeats is meaningful.
-      FunctionLifetimesOrError &existing_result =
-          analyzed[func->getCanonicalDecl()];
-      if (std::holds_alternative<FunctionLifetimes>(existing_result) &&
-          !IsIsomorphic(std::get<FunctionLifetimes>(existing_result),
-                        func_lifetimes_result.get())) {
-        existing_result = func_lifetimes_result.get();
-        func_lifetimes_changed = true;
+      summary = SerializeFunctionLifetimes(*lifetimes);
+    } else if (IsLifetimeElisionEnabled(callee, lifetime_context)) {
+      summary = "elided";
+    }
+    callee_summaries.push_back(absl::StrCat(*callee_usr, "=", summary));
+  }
+  std::sort(callee_summaries.begin(), callee_summaries.end());
+
+  return absl::StrCat(
+      "v", kFunctionSummaryVersion, ";", *func_usr, ";",
+      const_cast<clang::FunctionDecl *>(definition)->getODRHash(), ";",
+      IsLifetimeElisionEnabled(func, lifetime_context) ? "elided" : "explicit",
+      ";", GetReachedRecordsDigest(definition), ";",
+      absl::StrJoin(callee_summaries, ";"));
+}
+
+// Returns the lifetimes to assume for `func` when its analysis was stopped with
+// `err` because it exceeded the budget, and reports this as a warning.
+// These are the lifetimes annotated on `func` if there are any. Otherwise, all
+// lifetimes in the signature of `func` are the same, which is the most
+// conservative assumption callers can make about it.
+FunctionLifetimesOrError
+FallBackAfterExceededBudget(const clang::FunctionDecl *func,
+                            const LifetimeAnnotationContext &lifetime_context,
+                            llvm::Error err,
+                            const DiagnosticReporter &diag_reporter) {
+  std::string message = llvm::toString(std::move(err));
+
+  FunctionLifetimes func_lifetimes;
+  llvm::Expected<FunctionLifetimes> annotations =
+      GetLifetimeAnnotations(func, lifetime_context);
+  if (annotations) {
+    func_lifetimes = std::move(*annotations);
+    absl::StrAppend(&message, "; using the annotated lifetimes instead");
+  } else {
+    llvm::consumeError(annotations.takeError());
+    Lifetime lifetime = Lifetime::CreateVariable();
+    FunctionLifetimeFactorySingleCallback factory(
+        [lifetime](const clang::Expr *) { return lifetime; });
+    if (llvm::Error err = FunctionLifetimes::CreateForDecl(func, factory)
+                              .moveInto(func_lifetimes)) {
+      return FunctionAnalysisError(err);
+    }
+    absl::StrAppend(&message,
+                    "; assuming that all lifetimes in the signature are the "
+                    "same instead");
+  }
+
+  diag_reporter(func->getBeginLoc(), message, clang::DiagnosticIDs::Warning);
+  return func_lifetimes;
+}
+
+// Analyzes `func`, which is not part of a recursive cycle and whose callees
+// have all been analyzed. If there is a `summary_store`, the result is looked
+// up there first, and stored there if it had to be computed.
+// If the analysis exceeds the budget, the result is determined by
+// `FallBackAfterExceededBudget()` and is not stored.
+FunctionLifetimesOrError AnalyzeFunctionOrLookUpSummary(
+    const clang::FunctionDecl *func,
+    const llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
+        &analyzed,
+    const LifetimeAnnotationContext &lifetime_context,
+    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
+    CallGraph &call_graph, DataflowSession &session,
+    FunctionSummaryStore *summary_store) {
+  std::optional<std::string> summary_key;
+  if (summary_store != nullptr) {
+    summary_key =
+        GetFunctionSummaryKey(func, analyzed, lifetime_context, call_graph);
+    if (summary_key) {
+      if (std::optional<FunctionLifetimes> summary =
+              summary_store->Lookup(func, *summary_key)) {
+        return *std::move(summary);
       }
     }
   }
 
-  return llvm::Error::success();
+  auto analysis_result = AnalyzeSingleFunction(func, analyzed, diag_reporter,
+                                               debug_info, session);
+  if (!analysis_result) {
+    if (session.ExceededBudget(func->getDefinition())) {
+      return FallBackAfterExceededBudget(func, lifetime_context,
+                                         analysis_result.takeError(),
+                                         diag_reporter);
+    }
+    return FunctionAnalysisError(analysis_result.takeError());
+  }
+  auto func_lifetimes_result = ConstructFunctionLifetimes(
+      func, std::move(analysis_result.get()), diag_reporter);
+  if (!func_lifetimes_result) {
+    return FunctionAnalysisError(func_lifetimes_result.takeError());
+  }
+
+  if (summary_key) {
+    if (llvm::Error err =
+            summary_store->Store(*summary_key, func_lifetimes_result.get())) {
+      diag_reporter(
+          func->getBeginLoc(),
+          absl::StrCat("Could not store the summary of the function: ",
+                       llvm::toString(std::move(err))),
+          clang::DiagnosticIDs::Warning);
+    }
+  }
+  return func_lifetimes_result.get();
 }
 
+// A function whose callees (and base methods or overrides) are being visited
+// by `AnalyzeFunctionRecursive()`.
+struct CallGraphTraversalFrame {
+  const clang::FunctionDecl *func;
+  // Whether `func` is visited as part of an overrides traversal for a virtual
+  // method.
+  bool in_overrides_traversal;
+  // The position of `func` in the visited call stack.
+  size_t func_in_visited;
+  // The lowest position in the visited call stack of a function that we have
+  // found to be reachable from `func` (the "lowlink" in Tarjan's algorithm for
+  // strongly connected components). If this is below `func_in_visited`, `func`
+  // is part of a recursive cycle whose entry point is further down the stack.
+  size_t lowest_reachable;
+  // Whether we are visiting the callees of `func`, or (afterwards, if `func` is
+  // a virtual method) its base methods or overrides.
+  bool visiting_callees = true;
+  // The functions to visit, and the position of the next one.
+  llvm::SmallVector<const clang::FunctionDecl *> to_visit;
+  size_t next_to_visit = 0;
+  // Whether we have initiated an overrides traversal from the base methods of
+  // `func`.
+  bool visited_bases = false;
+  // The overrides of `func` if we are in an overrides traversal.
+  llvm::SmallPtrSet<const clang::CXXMethodDecl *, 2> overrides;
+};
+
 // The entry point for analyzing a function named by `func`.
 //
-// This function is recursive as it searches for and walks through all CallExpr
-// instances, calling this function again for each function. This is done to
-// analyze the leaves of the call graph first, so that when analyzing a given
-// function, all the functions it calls have already been analyzed.
+// This function walks the call graph depth-first from `func`, through all
+// CallExpr instances, to analyze the leaves of the call graph first, so that
+// when analyzing a given function, all the functions it calls have already been
+// analyzed. The walk keeps an explicit stack of `CallGraphTraversalFrame`s
+// rather than recursing, so deep call chains don't overflow the native stack.
 //
 // This function also handles walking through recursive cycles of function
-// calls. When a cycle is detected, we:
+// calls, which it finds using Tarjan's algorithm for strongly connected
+// components. When a cycle is detected, we:
 // 1. Do not analyze any of the functions until the cycle is fully explored and
 //    we've returned to the entry point to the cycle.
 // 2. At that point, we generate a FunctionLifetimes for each function in the
@@ -1097,225 +1706,250 @@ llvm::Error AnalyzeRecursiveFunctions(
 //    FunctionLifetimes, connecting lifetimes within the body of each function.
 //    This changes a given function's resulting FunctionLifetimes, which can
 //    affect the callers to it.
-// 4. Thus we repeat step 3 until we see that the FunctionLifetimes have stopped
-//    changing when we analyze each function in the cycle.
+// 4. Thus we repeat step 3 for the callers (in the cycle) of each function
+//    whose FunctionLifetimes changed, until they stop changing.
 void AnalyzeFunctionRecursive(
     llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
         &analyzed,
-    llvm::SmallVectorImpl<VisitedCallStackEntry> &visited,
     const clang::FunctionDecl *func,
     const LifetimeAnnotationContext &lifetime_context,
     const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
-    const BaseToOverrides &base_to_overrides) {
-  // Make sure we're always using the canonical declaration when using the
-  // function as a key in maps and sets.
-  func = func->getCanonicalDecl();
-
-  // See if we have finished analyzing the function.
-  bool is_analyzed = analyzed.count(func) > 0;
+    CallGraph &call_graph, DataflowSession &session,
+    FunctionSummaryStore *summary_store) {
+  VisitedCallStack visited;
+  llvm::SmallVector<CallGraphTraversalFrame> frames;
+
+  // Starts analyzing `func`. Pushes a frame for `func` if we need to visit its
+  // callees first.
+  auto enter = [&](const clang::FunctionDecl *func) {
+    // Make sure we're always using the canonical declaration when using the
+    // function as a key in maps and sets.
+    func = func->getCanonicalDecl();
 
-  auto *cxxmethod = clang::dyn_cast<clang::CXXMethodDecl>(func);
-  bool is_virtual = cxxmethod != nullptr && cxxmethod->isVirtual();
-  bool is_pure_virtual = is_virtual && cxxmethod->isPure();
+    // See if we have finished analyzing the function.
+    bool is_analyzed = analyzed.count(func) > 0;
 
-  if (func->getBuiltinID() != 0) {
-    return;
-  }
+    auto *cxxmethod = clang::dyn_cast<clang::CXXMethodDecl>(func);
+    bool is_virtual = cxxmethod != nullptr && cxxmethod->isVirtual();
+    bool is_pure_virtual = is_virtual && cxxmethod->isPure();
 
-  if (!func->isDefined() && !is_pure_virtual && !is_analyzed) {
-    FunctionLifetimes annotations;
-    if (llvm::Error err = GetLifetimeAnnotations(func, lifetime_context)
-                              .moveInto(annotations)) {
-      analyzed[func] = FunctionAnalysisError(err);
-    } else {
-      analyzed[func] = annotations;
+    if (func->getBuiltinID() != 0) {
+      return;
     }
-    return;
-  }
 
-  // Check if we're in an overrides traversal for a virtual method.
-  bool in_overrides_traversal =
-      visited.empty() ? false : visited.back().in_overrides_traversal;
+    if (!func->isDefined() && !is_pure_virtual && !is_analyzed) {
+      FunctionLifetimes annotations;
+      if (llvm::Error err = GetLifetimeAnnotations(func, lifetime_context)
+                                .moveInto(annotations)) {
+        analyzed[func] = FunctionAnalysisError(err);
+      } else {
+        analyzed[func] = annotations;
+      }
+      return;
+    }
 
-  if (is_analyzed && !in_overrides_traversal) {
-    // This function is already analyzed and this analysis is not for an
-    // overrides traversal (where repeated update may happen).
-    // TODO(kinuko): Avoid repeatedly visit the same virtual methods again and
-    // again if all the methods in the same overriding chain are already
-    // analyzed.
-    return;
-  }
+    // Check if we're in an overrides traversal for a virtual method.
+    bool in_overrides_traversal =
+        visited.empty() ? false : visited.back().in_overrides_traversal;
+
+    if (is_analyzed && !in_overrides_traversal) {
+      // This function is already analyzed and this analysis is not for an
+      // overrides traversal (where repeated update may happen).
+      // TODO(kinuko): Avoid repeatedly visit the same virtual methods again and
+      // again if all the methods in the same overriding chain are already
+      // analyzed.
+      return;
+    }
 
-  if (!in_overrides_traversal && FindAndMarkCycleWithFunc(visited, func)) {
-    // Defer analyzing the cycle until we have fully explored the recursive
-    // cycle graph.
     // This cycle check should exclude in_overrides_traversal case, because the
     // traversal can come back to the same function while traversing from its
     // overridden base method, e.g. when we see Child::f() we start the analysis
     // from its overridden implementation Base::f() and then recursively look
     // into its overrides until it reaches its final overrides (and it should
     // see Child::f() on its way.
+    if (!in_overrides_traversal) {
+      if (std::optional<size_t> func_in_visited = visited.Find(func)) {
+        // Defer analyzing the cycle until we have fully explored the recursive
+        // cycle graph.
+        // TODO(kinuko): We may return here when Base::f() calls f() even when
+        // it has overrides, and if it happens AnalyzeRecursiveFunctions don't
+        // look into the overrides so the Base::f() lifetime is not updated.
+        // See DISABLED_FunctionVirtualInheritanceWithComplexRecursion tests.
+        visited[*func_in_visited].in_cycle = true;
+        CallGraphTraversalFrame &caller = frames.back();
+        caller.lowest_reachable =
+            std::min(caller.lowest_reachable, *func_in_visited);
+        return;
+      }
+    }
 
-    // TODO(kinuko): We may return here when Base::f() calls f() even when
-    // it has overrides, and if it happens AnalyzeRecursiveFunctions don't
-    // look into the overrides so the Base::f() lifetime is not updated.
-    // See DISABLED_FunctionVirtualInheritanceWithComplexRecursion tests.
-    return;
-  }
-
-  auto maybe_callees = GetCallees(func);
-  if (!maybe_callees) {
-    analyzed[func] = FunctionAnalysisError(maybe_callees.takeError());
-    return;
-  }
-
-  // Keep track of where `func` is found in the call stack. It may not be at the
-  // top anymore after we return from calling `AnalyzeFunctionRecursive()` if
-  // `func` is part of a recursive cycle, as we keep all members of the
-  // recursive cycle in the `visited` stack until we explore the whole graph and
-  // then analyze it all.
-  size_t func_in_visited = visited.size();
-  visited.emplace_back(VisitedCallStackEntry{
-      .func = func, .in_cycle = false, .in_overrides_traversal = false});
-
-  for (auto &callee : maybe_callees.get()) {
-    if (analyzed.count(callee)) {
-      continue;
+    auto maybe_callees = call_graph.GetCallees(func);
+    if (!maybe_callees) {
+      analyzed[func] = FunctionAnalysisError(maybe_callees.takeError());
+      return;
     }
-    AnalyzeFunctionRecursive(analyzed, visited, callee, lifetime_context,
-                             diag_reporter, debug_info, base_to_overrides);
-  }
 
-  llvm::DenseSet<const clang::CXXMethodDecl *> bases;
-  llvm::SmallPtrSet<const clang::CXXMethodDecl *, 2> overrides;
+    size_t func_in_visited = visited.size();
+    visited.Push(func);
+    frames.push_back(CallGraphTraversalFrame{
+        .func = func,
+        .in_overrides_traversal = in_overrides_traversal,
+        .func_in_visited = func_in_visited,
+        .lowest_reachable = func_in_visited,
+        .to_visit = llvm::SmallVector<const clang::FunctionDecl *>(
+            maybe_callees.get().begin(), maybe_callees.get().end()),
+    });
+  };
 
-  // This is a virtual method and we want to recursively analyze the inheritance
-  // chain and update the base methods with their overrides. The base methods
-  // may be visited and updated repeatedly.
-  if (is_virtual) {
-    assert(cxxmethod != nullptr);
-    visited[func_in_visited].in_overrides_traversal = true;
-    if (!in_overrides_traversal) {
-      // If it's a virtual method and we are not yet in an overrides traversal,
-      // start from the base method.
-      GetBaseMethods(cxxmethod, bases);
-      for (const auto *base : bases) {
-        AnalyzeFunctionRecursive(analyzed, visited, base, lifetime_context,
-                                 diag_reporter, debug_info, base_to_overrides);
+  // Finishes analyzing the function of `frame`, once all of its callees (and
+  // base methods or overrides) have been visited.
+  auto finish = [&](const CallGraphTraversalFrame &frame) {
+    const clang::FunctionDecl *func = frame.func;
+    size_t func_in_visited = frame.func_in_visited;
+    assert(visited[func_in_visited].func == func);
+
+    // Once we get here, there are 3 possibilities for `func`.
+    //
+    // 1. If `func` is part of a cycle, but was not the first entry point of
+    //    the cycle, then we defer analyzing `func` until we get back to the
+    //    entry point. Note that we leave `func` in the `visited` call stack so
+    //    that once we get back to the recursive cycle's entry point, we can
+    //    see all the functions that are part of the cycle graph.
+    // 2. If `func` was not part of a cycle, we can analyze it and expect it to
+    //    have valid FunctionLifetimes already generated for anything it calls.
+    // 3. Otherwise, we collect the whole cycle (which may be just the `func` if
+    //    it calls itself directly), and we analyze the cycle as a whole.
+
+    if (frame.lowest_reachable < func_in_visited) {
+      // Case 1. In a recursive cycle, but not the entry point.
+      return;
+    }
+    if (func_in_visited == visited.size() - 1 &&
+        !visited[func_in_visited].in_cycle) {
+      // Case 2. Not part of a cycle.
+      if (!frame.visited_bases) {
+        // This function is not where we initiated an overrides traversal from
+        // its base methods.
+        analyzed[func] = AnalyzeFunctionOrLookUpSummary(
+            func, analyzed, lifetime_context, diag_reporter, debug_info,
+            call_graph, session, summary_store);
+        // Functions in an overrides traversal may be analyzed again.
+        if (!frame.in_overrides_traversal)
+          session.ReleaseControlFlowContext(func);
+      } else {
+        // In this branch we have initiated (and finished) an overrides
+        // traversal starting with its base method, and the traversal for this
+        // function must be already done as a part of the overrides traversal.
+        assert(analyzed.count(func) > 0);
       }
     } else {
-      // We are in an overrides traversal for a virtual method starting from its
-      // base method. Recursively look into the overrides that this TU knows
-      // about, so that the base method's analysis result can be updated with
-      // the overrides (that are discovered in this TU).
-      auto iter = base_to_overrides.find(cxxmethod->getCanonicalDecl());
-      if (iter != base_to_overrides.end()) {
-        overrides = iter->second;
-        for (const auto *derived : overrides) {
-          AnalyzeFunctionRecursive(analyzed, visited, derived, lifetime_context,
-                                   diag_reporter, debug_info,
-                                   base_to_overrides);
+      // Case 3. The entry point to a recursive cycle. All functions above
+      // `func` in the `visited` call stack are part of the cycle.
+      for (size_t i = func_in_visited; i < visited.size(); ++i) {
+        visited[i].in_cycle = true;
+      }
+      auto funcs_in_cycle = visited.EntriesFrom(func_in_visited);
+      if (llvm::Error err =
+              AnalyzeRecursiveFunctions(funcs_in_cycle, analyzed, diag_reporter,
+                                        debug_info, call_graph, session)) {
+        for (const auto [func_in_cycle, _1, _2] : funcs_in_cycle) {
+          analyzed[func_in_cycle] = FunctionAnalysisError(err);
+        }
+      }
+      if (!frame.in_overrides_traversal) {
+        for (const auto [func_in_cycle, _1, _2] : funcs_in_cycle) {
+          session.ReleaseControlFlowContext(func_in_cycle);
         }
       }
     }
-    visited[func_in_visited].in_overrides_traversal = false;
-  }
 
-  // Recursing through CallExprs should not remove `func` from the stack, though
-  // there may be more on the stack after `func` if they are all part of a
-  // recursive cycle graph.
-  assert(visited[func_in_visited].func == func);
-  if (func_in_visited < visited.size() - 1) {
-    for (size_t i = func_in_visited; i < visited.size(); ++i) {
-      assert(visited[i].in_cycle);
+    // If this has overrides and we're in an overrides traversal, the lifetimes
+    // need to be (recursively) updated with the results of the overrides.
+    if (frame.in_overrides_traversal) {
+      if (llvm::Error err = UpdateFunctionLifetimesWithOverrides(
+              func, analyzed, frame.overrides)) {
+        analyzed[func] = FunctionAnalysisError(err);
+      }
     }
-  }
 
-  // Once we return back here, there are 3 possibilities for `func`.
-  //
-  // 1. If `func` is part of a cycle, but was not the first entry point of the
-  //    cycle, then we defer analyzing `func` until we get back to the entry
-  //    point. We look for this by seeing if there is another function marked as
-  //    being in a cycle above `func` in the `visited` call stack. Note that we
-  //    will leave `func` in the `visited` call stack when we return so that
-  //    once we get back to the recursive cycle's entry point, we can see all
-  //    the functions that are part of the cycle graph.
-  // 2. If `func` was not part of a cycle, we can analyze it and expect it to
-  //    have valid FunctionLifetimes already generated for anything it calls.
-  // 3. Otherwise, we collect the whole cycle (which may be just the `func` if
-  //    it calls itself directly), and we analyze the cycle as a whole.
+    // Once we have finished analyzing `func`, we can remove it from the visited
+    // stack, along with anything it called in a recursive cycle (which will be
+    // found after `func` in the `visited` call stack.
+    visited.PopTo(func_in_visited);
+  };
 
-  if (func_in_visited > 0 && visited[func_in_visited].in_cycle &&
-      visited[func_in_visited - 1].in_cycle) {
-    // Case 1. In a recursive cycle, but not the entry point.
-    return;
-  }
-  if (!visited[func_in_visited].in_cycle) {
-    // Case 2. Not part of a cycle.
-    if (bases.empty()) {
-      // This function is not where we initiated an overrides traversal from its
-      // base methods.
-      auto analysis_result =
-          AnalyzeSingleFunction(func, analyzed, diag_reporter, debug_info);
-      if (!analysis_result) {
-        analyzed[func] = FunctionAnalysisError(analysis_result.takeError());
-      } else {
-        auto func_lifetimes_result = ConstructFunctionLifetimes(
-            func, std::move(analysis_result.get()), diag_reporter);
-        if (!func_lifetimes_result) {
-          analyzed[func] =
-              FunctionAnalysisError(func_lifetimes_result.takeError());
-        } else {
-          analyzed[func] = func_lifetimes_result.get();
-        }
+  enter(func);
+  while (!frames.empty()) {
+    CallGraphTraversalFrame &frame = frames.back();
+
+    if (frame.next_to_visit < frame.to_visit.size()) {
+      const clang::FunctionDecl *next = frame.to_visit[frame.next_to_visit++];
+      if (frame.visiting_callees && analyzed.count(next)) {
+        continue;
       }
-    } else {
-      // In this branch we have initiated (and finished) an overrides
-      // traversal starting with its base method, and the traversal for this
-      // function must be already done as a part of the overrides traversal.
-      assert(is_virtual);
-      assert(analyzed.count(func) > 0);
+      // This may push a new frame, invalidating `frame`.
+      enter(next);
+      continue;
     }
-  } else {
-    // Case 3. The entry point to a recursive cycle.
-    auto funcs_in_cycle =
-        llvm::ArrayRef<VisitedCallStackEntry>(visited).drop_front(
-            func_in_visited);
-    if (llvm::Error err = AnalyzeRecursiveFunctions(
-            funcs_in_cycle, analyzed, diag_reporter, debug_info)) {
-      for (const auto [func_in_cycle, _1, _2] : funcs_in_cycle) {
-        analyzed[func_in_cycle] = FunctionAnalysisError(err);
+
+    auto *cxxmethod = clang::dyn_cast<clang::CXXMethodDecl>(frame.func);
+    bool is_virtual = cxxmethod != nullptr && cxxmethod->isVirtual();
+
+    // This is a virtual method and we want to recursively analyze the
+    // inheritance chain and update the base methods with their overrides. The
+    // base methods may be visited and updated repeatedly.
+    if (is_virtual && frame.visiting_callees) {
+      frame.visiting_callees = false;
+      frame.to_visit.clear();
+      frame.next_to_visit = 0;
+      visited[frame.func_in_visited].in_overrides_traversal = true;
+      if (!frame.in_overrides_traversal) {
+        // If it's a virtual method and we are not yet in an overrides
+        // traversal, start from the base method.
+        llvm::DenseSet<const clang::CXXMethodDecl *> bases;
+        GetBaseMethods(cxxmethod, bases);
+        frame.to_visit.append(bases.begin(), bases.end());
+        frame.visited_bases = !bases.empty();
+      } else if (const auto *overrides = call_graph.GetOverrides(cxxmethod)) {
+        // We are in an overrides traversal for a virtual method starting from
+        // its base method. Look into the overrides that this TU knows about,
+        // so that the base method's analysis result can be updated with the
+        // overrides (that are discovered in this TU).
+        frame.overrides = *overrides;
+        frame.to_visit.append(overrides->begin(), overrides->end());
       }
+      continue;
+    }
+    if (is_virtual) {
+      visited[frame.func_in_visited].in_overrides_traversal = false;
     }
-  }
 
-  // If this has overrides and we're in an overrides traversal, the lifetimes
-  // need to be (recursively) updated with the results of the overrides.
-  if (in_overrides_traversal) {
-    if (llvm::Error err =
-            UpdateFunctionLifetimesWithOverrides(func, analyzed, overrides)) {
-      analyzed[func] = FunctionAnalysisError(err);
+    CallGraphTraversalFrame finished = std::move(frame);
+    frames.pop_back();
+    finish(finished);
+    if (!frames.empty()) {
+      CallGraphTraversalFrame &caller = frames.back();
+      caller.lowest_reachable =
+          std::min(caller.lowest_reachable, finished.lowest_reachable);
     }
   }
 
-  // Once we have finished analyzing `func`, we can remove it from the visited
-  // stack, along with anything it called in a recursive cycle (which will be
-  // found after `func` in the `visited` call stack.
-  visited.resize(func_in_visited);
+  // All overrides traversals started from `func` are done, so the results of
+  // the functions they analyzed are final too.
+  session.ReleaseControlFlowContexts();
 }
 
 llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
 AnalyzeTranslationUnitAndCollectTemplates(
-    const clang::TranslationUnitDecl *tu,
     const LifetimeAnnotationContext &lifetime_context,
     const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
     llvm::DenseMap<clang::FunctionTemplateDecl *, const clang::FunctionDecl *>
         &uninstantiated_templates,
-    const BaseToOverrides &base_to_overrides) {
+    CallGraph &call_graph, DataflowSession &session,
+    FunctionSummaryStore *summary_store) {
   llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError> result;
-  llvm::SmallVector<VisitedCallStackEntry> visited;
 
-  for (const clang::FunctionDecl *func : GetAllFunctionDefinitions(tu)) {
+  for (const clang::FunctionDecl *func : call_graph.Definitions()) {
     // Skip templated functions.
     if (func->isTemplated()) {
       clang::FunctionTemplateDecl *template_decl =
@@ -1331,15 +1965,8 @@ AnalyzeTranslationUnitAndCollectTemplates(
       uninstantiated_templates.erase(info->getTemplate());
     }
 
-    // For some reason that's not clear to mboehme@, the AST matcher is
-    // returning two matches for every function definition; maybe there are two
-    // different paths from a TranslationUnitDecl to a function definition.
-    // This doesn't really have any ill effect, however, as
-    // AnalyzeFunctionRecursive() bails out anyway if it has analyzed the
-    // function before.
-
-    AnalyzeFunctionRecursive(result, visited, func, lifetime_context,
-                             diag_reporter, debug_info, base_to_overrides);
+    AnalyzeFunctionRecursive(result, func, lifetime_context, diag_reporter,
+                             debug_info, call_graph, session, summary_store);
   }
 
   return result;
@@ -1367,21 +1994,23 @@ void AnalyzeTemplateFunctionsInSeparateASTContext(
     const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
     const std::map<std::string, const clang::FunctionDecl *>
         &template_usr_to_decl,
-    const BaseToOverrides &base_to_overrides, clang::ASTContext &context) {
+    FunctionSummaryStore *summary_store, const AnalysisBudget &budget,
+    clang::ASTContext &context) {
   llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
       inner_result;
-  llvm::SmallVector<VisitedCallStackEntry> inner_visited;
   FunctionDebugInfoMap inner_debug_info;
+  CallGraph inner_call_graph =
+      CallGraph::ForTranslationUnit(context.getTranslationUnitDecl());
+  DataflowSession inner_session(budget);
 
-  for (const clang::FunctionDecl *func :
-       GetAllFunctionDefinitions(context.getTranslationUnitDecl())) {
+  for (const clang::FunctionDecl *func : inner_call_graph.Definitions()) {
     // Skip templated functions.
     if (func->isTemplated())
       continue;
 
-    AnalyzeFunctionRecursive(inner_result, inner_visited, func,
-                             lifetime_context, diag_reporter, &inner_debug_info,
-                             base_to_overrides);
+    AnalyzeFunctionRecursive(inner_result, func, lifetime_context,
+                             diag_reporter, &inner_debug_info, inner_call_graph,
+                             inner_session, summary_store);
   }
 
   // We need to remap the results with FunctionDecl* in the
@@ -1411,6 +2040,57 @@ void AnalyzeTemplateFunctionsInSeparateASTContext(
   }
 }
 
+// Instantiate the templates in `uninstantiated_templates` with placeholder
+// types in the original ASTContext (using `sema`) and run
+// AnalyzeFunctionRecursive on the instantiations. Report results through
+// `result_callback`, with the results for the instantiations reported for the
+// templated functions they were instantiated from.
+void AnalyzeTemplateFunctionsInSameASTContext(
+    const LifetimeAnnotationContext &lifetime_context,
+    const llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
+        &initial_result,
+    const FunctionAnalysisResultCallback &result_callback,
+    const DiagnosticReporter &diag_reporter, FunctionDebugInfoMap *debug_info,
+    const llvm::DenseMap<clang::FunctionTemplateDecl *,
+                         const clang::FunctionDecl *> &uninstantiated_templates,
+    CallGraph &call_graph, DataflowSession &session,
+    FunctionSummaryStore *summary_store, clang::Sema &sema) {
+  // The placeholder instantiations (and the instantiations of their callees)
+  // are analyzed on top of the existing results, but only reported through
+  // the templated functions.
+  llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
+      analyzed = initial_result;
+  FunctionDebugInfoMap placeholder_debug_info;
+  llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
+      template_result;
+
+  for (const auto &[tmpl, func] : uninstantiated_templates) {
+    clang::FunctionDecl *instantiation;
+    if (llvm::Error err =
+            InstantiateWithPlaceholders(sema, tmpl).moveInto(instantiation)) {
+      template_result.insert({func, FunctionAnalysisError(err)});
+      continue;
+    }
+    AnalyzeFunctionRecursive(analyzed, instantiation, lifetime_context,
+                             diag_reporter,
+                             debug_info ? &placeholder_debug_info : nullptr,
+                             call_graph, session, summary_store);
+    template_result.insert({func, analyzed.lookup(instantiation)});
+    if (debug_info) {
+      auto iter = placeholder_debug_info.find(instantiation);
+      if (iter != placeholder_debug_info.end())
+        (*debug_info)[func] = iter->second;
+    }
+  }
+
+  for (const auto &[decl, lifetimes_or_error] : initial_result) {
+    result_callback(decl, lifetimes_or_error);
+  }
+  for (const auto &[decl, lifetimes_or_error] : template_result) {
+    result_callback(decl, lifetimes_or_error);
+  }
+}
+
 DiagnosticReporter
 DiagReporterForDiagEngine(clang::DiagnosticsEngine &diag_engine) {
   return
@@ -1436,19 +2116,20 @@ bool IsIsomorphic(const FunctionLifetimes &a, const FunctionLifetimes &b) {
 FunctionLifetimesOrError
 AnalyzeFunction(const clang::FunctionDecl *func,
                 const LifetimeAnnotationContext &lifetime_context,
-                FunctionDebugInfo *debug_info) {
+                FunctionDebugInfo *debug_info, const AnalysisBudget &budget) {
   llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
       analyzed;
-  llvm::SmallVector<VisitedCallStackEntry> visited;
   std::optional<FunctionDebugInfoMap> debug_info_map;
   if (debug_info) {
     debug_info_map.emplace();
   }
   DiagnosticReporter diag_reporter =
       DiagReporterForDiagEngine(func->getASTContext().getDiagnostics());
-  AnalyzeFunctionRecursive(
-      analyzed, visited, func, lifetime_context, diag_reporter,
-      debug_info_map ? &debug_info_map.value() : nullptr, BaseToOverrides());
+  CallGraph call_graph;
+  DataflowSession session(budget);
+  AnalyzeFunctionRecursive(analyzed, func, lifetime_context, diag_reporter,
+                           debug_info_map ? &debug_info_map.value() : nullptr,
+                           call_graph, session, /*summary_store=*/nullptr);
   if (debug_info) {
     *debug_info = debug_info_map->lookup(func);
   }
@@ -1459,7 +2140,9 @@ llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
 AnalyzeTranslationUnit(const clang::TranslationUnitDecl *tu,
                        const LifetimeAnnotationContext &lifetime_context,
                        DiagnosticReporter diag_reporter,
-                       FunctionDebugInfoMap *debug_info) {
+                       FunctionDebugInfoMap *debug_info,
+                       FunctionSummaryStore *summary_store,
+                       const AnalysisBudget &budget) {
   if (!diag_reporter) {
     diag_reporter =
         DiagReporterForDiagEngine(tu->getASTContext().getDiagnostics());
@@ -1468,15 +2151,17 @@ AnalyzeTranslationUnit(const clang::TranslationUnitDecl *tu,
   llvm::DenseMap<clang::FunctionTemplateDecl *, const clang::FunctionDecl *>
       uninstantiated_templates;
 
-  // Builds a map from a base method to its overrides within this TU. It will
-  // not find out all the overrides, but still cover (and can partially update)
-  // all the base methods that this TU implements.
-  auto base_to_overrides = BuildBaseToOverrides(tu);
+  // Collects the function definitions, their callees and the overrides of
+  // base methods within this TU. It will not find out all the overrides, but
+  // still cover (and can partially update) all the base methods that this TU
+  // implements.
+  CallGraph call_graph = CallGraph::ForTranslationUnit(tu);
+  DataflowSession session(budget);
 
   llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError> result =
       AnalyzeTranslationUnitAndCollectTemplates(
-          tu, lifetime_context, diag_reporter, debug_info,
-          uninstantiated_templates, base_to_overrides);
+          lifetime_context, diag_reporter, debug_info,
+          uninstantiated_templates, call_graph, session, summary_store);
 
   return result;
 }
@@ -1485,7 +2170,9 @@ void AnalyzeTranslationUnitWithTemplatePlaceholder(
     const clang::TranslationUnitDecl *tu,
     const LifetimeAnnotationContext &lifetime_context,
     const FunctionAnalysisResultCallback &result_callback,
-    DiagnosticReporter diag_reporter, FunctionDebugInfoMap *debug_info) {
+    DiagnosticReporter diag_reporter, FunctionDebugInfoMap *debug_info,
+    FunctionSummaryStore *summary_store, clang::Sema *sema,
+    const AnalysisBudget &budget) {
   if (!diag_reporter) {
     diag_reporter =
         DiagReporterForDiagEngine(tu->getASTContext().getDiagnostics());
@@ -1494,15 +2181,25 @@ void AnalyzeTranslationUnitWithTemplatePlaceholder(
   llvm::DenseMap<clang::FunctionTemplateDecl *, const clang::FunctionDecl *>
       uninstantiated_templates;
 
-  // Builds a map from a base method to its overrides within this TU. It will
-  // not find out all the overrides, but still cover (and can partially update)
-  // all the base methods that this TU implements.
-  auto base_to_overrides = BuildBaseToOverrides(tu);
+  // Collects the function definitions, their callees and the overrides of
+  // base methods within this TU. It will not find out all the overrides, but
+  // still cover (and can partially update) all the base methods that this TU
+  // implements.
+  CallGraph call_graph = CallGraph::ForTranslationUnit(tu);
+  DataflowSession session(budget);
 
   llvm::DenseMap<const clang::FunctionDecl *, FunctionLifetimesOrError>
       initial_result = AnalyzeTranslationUnitAndCollectTemplates(
-          tu, lifetime_context, diag_reporter, debug_info,
-          uninstantiated_templates, base_to_overrides);
+          lifetime_context, diag_reporter, debug_info,
+          uninstantiated_templates, call_graph, session, summary_store);
+
+  if (sema) {
+    AnalyzeTemplateFunctionsInSameASTContext(
+        lifetime_context, initial_result, result_callback, diag_reporter,
+        debug_info, uninstantiated_templates, call_graph, session,
+        summary_store, *sema);
+    return;
+  }
 
   // Make a map from USRString to funcDecls in the original ASTContext.
   std::map<std::string, const clang::FunctionDecl *> template_usr_to_decl;
@@ -1525,15 +2222,15 @@ void AnalyzeTranslationUnitWithTemplatePlaceholder(
   // placeholders. This is passed to RunToolOnCodeWithOverlay below.
   auto analyze_with_placeholder =
       [&lifetime_context, &initial_result, &result_callback, &diag_reporter,
-       &debug_info, &template_usr_to_decl,
-       &base_to_overrides](clang::ASTContext &context) {
+       &debug_info, &template_usr_to_decl, summary_store,
+       &budget](clang::ASTContext &context) {
         AnalyzeTemplateFunctionsInSeparateASTContext(
             lifetime_context, initial_result, result_callback, diag_reporter,
-            debug_info, template_usr_to_decl, base_to_overrides, context);
+            debug_info, template_usr_to_decl, summary_store, budget, context);
       };
 
-  // Run `analyze_with_placeholder` in a separate ASTContext on top of an
-  // overlaid filesystem with the `code_with_placeholder` file.
+  // Without a `Sema`, run `analyze_with_placeholder` in a separate ASTContext
+  // on top of an overlaid filesystem with the `code_with_placeholder` file.
   RunToolOnCodeWithOverlay(tu->getASTContext(), code_with_placeholder.filename,
                            code_with_placeholder.code,
                            analyze_with_placeholder);
@@ -9,10 +9,12 @@
 #include <string>
 #include <variant>
 
+#include "lifetime_analysis/function_summary_store.h"
 #include "lifetime_analysis/lifetime_analysis.h"
 #include "lifetime_annotations/function_lifetimes.h"
 #include "lifetime_annotations/lifetime_annotations.h"
 #include "clang/AST/Decl.h"
+#include "clang/Sema/Sema.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 
@@ -49,18 +51,29 @@ using FunctionDebugInfoMap =
     llvm::DenseMap<const clang::FunctionDecl*, FunctionDebugInfo>;
 
 // Runs a static analysis on `func` and returns the result.
+// If the analysis of a function exceeds `budget`, a warning is reported and
+// the function's annotated lifetimes are used instead. If it has none, all
+// lifetimes in its signature are assumed to be the same.
 FunctionLifetimesOrError AnalyzeFunction(
     const clang::FunctionDecl* func,
     const LifetimeAnnotationContext& lifetime_context,
-    FunctionDebugInfo* debug_info = nullptr);
+    FunctionDebugInfo* debug_info = nullptr,
+    const AnalysisBudget& budget = AnalysisBudget());
 
 // Runs a static analysis on all function definitions in `tu`.
 // The map that is returned references functions by their canonical declaration.
+// If `summary_store` is given, the results for functions that are not part of a
+// recursive cycle are looked up there (and stored there if they aren't found).
+// No debug info is produced for functions whose results are found.
+// `budget` is used as in `AnalyzeFunction()`; results that had to fall back
+// because of it are not stored in `summary_store`.
 llvm::DenseMap<const clang::FunctionDecl*, FunctionLifetimesOrError>
 AnalyzeTranslationUnit(const clang::TranslationUnitDecl* tu,
                        const LifetimeAnnotationContext& lifetime_context,
                        DiagnosticReporter diag_reporter = {},
-                       FunctionDebugInfoMap* debug_info = nullptr);
+                       FunctionDebugInfoMap* debug_info = nullptr,
+                       FunctionSummaryStore* summary_store = nullptr,
+                       const AnalysisBudget& budget = AnalysisBudget());
 
 // Callback that is used to report function analysis results.
 // Do not retain the `FunctionDecl*`, the `FunctionLifetimes`, or other objects
@@ -75,12 +88,23 @@ using FunctionAnalysisResultCallback =
 // Runs a static analysis on all function definitions in `tu`.
 // Analyzes and reports results for uninstantiated templates by instantiating
 // them with placeholder types, reporting results via `result_callback`.
+// `summary_store` and `budget` are used as in `AnalyzeTranslationUnit()`.
+// If `sema` (the `Sema` that built `tu`) is given, the templates are
+// instantiated in the `ASTContext` of `tu`. Otherwise, the translation unit is
+// parsed again together with generated explicit instantiations, which is
+// considerably slower.
+// Note that instantiating in the `ASTContext` of `tu` modifies the caller's
+// AST: the implicit placeholder structs and the instantiations of the
+// templates with them are added to it and stay there after this function
+// returns.
 void AnalyzeTranslationUnitWithTemplatePlaceholder(
     const clang::TranslationUnitDecl* tu,
     const LifetimeAnnotationContext& lifetime_context,
     const FunctionAnalysisResultCallback& result_callback,
     DiagnosticReporter diag_reporter = {},
-    FunctionDebugInfoMap* debug_info = nullptr);
+    FunctionDebugInfoMap* debug_info = nullptr,
+    FunctionSummaryStore* summary_store = nullptr, clang::Sema* sema = nullptr,
+    const AnalysisBudget& budget = AnalysisBudget());
 
 }  // namespace lifetimes
 }  // namespace tidy
@@ -0,0 +1,86 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "lifetime_analysis/function_summary_store.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "lifetime_annotations/lifetime.h"
+#include "lifetime_annotations/lifetime_annotations.h"
+#include "lifetime_annotations/lifetime_symbol_table.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FileUtilities.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA256.h"
+
+namespace clang {
+namespace tidy {
+namespace lifetimes {
+
+std::optional<FunctionLifetimes> FunctionSummaryStore::Lookup(
+    const clang::FunctionDecl* func, llvm::StringRef key) {
+  auto buffer = llvm::MemoryBuffer::getFile(EntryPath(key));
+  if (!buffer) {
+    ++misses_;
+    return std::nullopt;
+  }
+
+  // An entry is the key, followed by a newline and the summary. We check the
+  // key to guard against hash collisions.
+  auto [entry_key, summary] = (*buffer)->getBuffer().split('\n');
+  if (entry_key != key) {
+    ++misses_;
+    return std::nullopt;
+  }
+
+  LifetimeSymbolTable symbol_table;
+  llvm::Expected<FunctionLifetimes> lifetimes =
+      ParseLifetimeAnnotations(func, summary.str(), &symbol_table);
+  if (!lifetimes) {
+    llvm::consumeError(lifetimes.takeError());
+    ++misses_;
+    return std::nullopt;
+  }
+  ++hits_;
+  return std::move(*lifetimes);
+}
+
+llvm::Error FunctionSummaryStore::Store(llvm::StringRef key,
+                                        const FunctionLifetimes& lifetimes) {
+  if (std::error_code error_code =
+          llvm::sys::fs::create_directories(directory_)) {
+    return llvm::createStringError(
+        error_code, "Could not create the function summary store in '%s'",
+        directory_.c_str());
+  }
+  std::string path = EntryPath(key);
+  return llvm::writeFileAtomically(
+      absl::StrCat(path, "-%%%%%%%%"), path,
+      absl::StrCat(key.str(), "\n", SerializeFunctionLifetimes(lifetimes)));
+}
+
+std::string FunctionSummaryStore::EntryPath(llvm::StringRef key) const {
+  llvm::SmallString<128> path(directory_);
+  llvm::sys::path::append(
+      path, llvm::toHex(llvm::SHA256::hash(llvm::arrayRefFromStringRef(key)),
+                        /*LowerCase=*/true));
+  return std::string(path.str());
+}
+
+std::string SerializeFunctionLifetimes(const FunctionLifetimes& lifetimes) {
+  LifetimeSymbolTable symbol_table;
+  return lifetimes.DebugString([&symbol_table](Lifetime l) -> std::string {
+    return symbol_table.LookupLifetimeAndMaybeDeclare(l).str();
+  });
+}
+
+}  // namespace lifetimes
+}  // namespace tidy
+}  // namespace clang
@@ -0,0 +1,71 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef DEVTOOLS_RUST_CC_INTEROP_LIFETIME_ANALYSIS_FUNCTION_SUMMARY_STORE_H_
+#define DEVTOOLS_RUST_CC_INTEROP_LIFETIME_ANALYSIS_FUNCTION_SUMMARY_STORE_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "lifetime_annotations/function_lifetimes.h"
+#include "clang/AST/Decl.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Error.h"
+
+namespace clang {
+namespace tidy {
+namespace lifetimes {
+
+// An on-disk store for the FunctionLifetimes inferred for functions (their
+// "summaries"), shared between the analyses of different translation units.
+// With it, an inline function defined in a header is analyzed once, rather
+// than once for every translation unit that includes the header.
+//
+// Summaries are stored under a key that must identify everything the analysis
+// result depends on: the function, its body, the definitions of the types it
+// uses, and the summaries of its callees.
+// The store doesn't interpret keys; see `AnalyzeTranslationUnit()` for how they
+// are computed.
+//
+// Entries are written atomically, so multiple analyses may share a store
+// concurrently.
+class FunctionSummaryStore {
+ public:
+  // Creates a store that keeps its entries in `directory`, which is created
+  // when the first entry is stored.
+  explicit FunctionSummaryStore(std::string directory)
+      : directory_(std::move(directory)) {}
+
+  // Returns the summary stored under `key`, or nullopt if there is none.
+  // `func` is the function that the summary is for.
+  std::optional<FunctionLifetimes> Lookup(const clang::FunctionDecl* func,
+                                          llvm::StringRef key);
+
+  // Stores `lifetimes` under `key`.
+  llvm::Error Store(llvm::StringRef key, const FunctionLifetimes& lifetimes);
+
+  // Returns how many lookups found a summary in the store.
+  int64_t hits() const { return hits_; }
+
+  // Returns how many lookups didn't find a summary in the store.
+  int64_t misses() const { return misses_; }
+
+ private:
+  std::string EntryPath(llvm::StringRef key) const;
+
+  std::string directory_;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+};
+
+// Returns `lifetimes` in the "a, b -> a" syntax of lifetime annotations, with
+// lifetimes named in the order in which they appear.
+std::string SerializeFunctionLifetimes(const FunctionLifetimes& lifetimes);
+
+}  // namespace lifetimes
+}  // namespace tidy
+}  // namespace clang
+
+#endif  // DEVTOOLS_RUST_CC_INTEROP_LIFETIME_ANALYSIS_FUNCTION_SUMMARY_STORE_H_
@@ -4,6 +4,7 @@
 
 #include "lifetime_analysis/lifetime_analysis.h"
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -12,6 +13,7 @@
 #include <variant>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "lifetime_analysis/builtin_lifetimes.h"
 #include "lifetime_analysis/object.h"
 #include "lifetime_analysis/object_repository.h"
@@ -51,13 +53,13 @@ class TransferStmtVisitor
 public:
   TransferStmtVisitor(
       ObjectRepository &object_repository, PointsToMap &points_to_map,
-      LifetimeConstraints &constraints, ObjectSet &single_valued_objects,
-      const clang::FunctionDecl *func,
+      ExprObjectMap &expr_objects, LifetimeConstraints &constraints,
+      ObjectSet &single_valued_objects, const clang::FunctionDecl *func,
       const llvm::DenseMap<const clang::FunctionDecl *,
                            FunctionLifetimesOrError> &callee_lifetimes,
       const DiagnosticReporter &diag_reporter)
       : object_repository_(object_repository), points_to_map_(points_to_map),
-        constraints_(constraints),
+        expr_objects_(expr_objects), constraints_(constraints),
         single_valued_objects_(single_valued_objects), func_(func),
         callee_lifetimes_(callee_lifetimes), diag_reporter_(diag_reporter) {}
 
@@ -91,6 +93,7 @@ public:
 private:
   ObjectRepository &object_repository_;
   PointsToMap &points_to_map_;
+  ExprObjectMap &expr_objects_;
   LifetimeConstraints &constraints_;
   ObjectSet &single_valued_objects_;
   const clang::FunctionDecl *func_;
@@ -276,6 +279,7 @@ void TransferInitializer(const Object *dest, clang::QualType type,
                          const ObjectRepository &object_repository,
                          const clang::Expr *init_expr,
                          TargetPointeeBehavior pointee_behavior,
+                         const ExprObjectMap &expr_objects,
                          PointsToMap &points_to_map,
                          LifetimeConstraints &constraints) {
   type = type.getCanonicalType();
@@ -296,7 +300,8 @@ void TransferInitializer(const Object *dest, clang::QualType type,
         ++init;
         TransferInitializer(object_repository.GetFieldObject(dest, f),
                             f->getType(), object_repository, field_init,
-                            pointee_behavior, points_to_map, constraints);
+                            pointee_behavior, expr_objects, points_to_map,
+                            constraints);
       }
       return;
     }
@@ -304,7 +309,7 @@ void TransferInitializer(const Object *dest, clang::QualType type,
 
   if (type->isPointerType() || type->isReferenceType() ||
       type->isStructureOrClassType()) {
-    ObjectSet init_points_to = points_to_map.GetExprObjectSet(init_expr);
+    ObjectSet init_points_to = expr_objects.GetExprObjectSet(init_expr);
     if (pointee_behavior == TargetPointeeBehavior::kKeep) {
       // It's important to use "Extend" (not "Set") here because we process
       // initializers for member variables only _after_ the dataflow analysis
@@ -343,12 +348,45 @@ void LifetimeAnalysis::transfer(
   auto stmt = cfg_stmt->getStmt();
 
   TransferStmtVisitor visitor(object_repository_, state.PointsTo(),
-                              state.Constraints(), state.SingleValuedObjects(),
-                              func_, callee_lifetimes_, diag_reporter_);
+                              expr_objects_, state.Constraints(),
+                              state.SingleValuedObjects(), func_,
+                              callee_lifetimes_, diag_reporter_);
   if (std::optional<std::string> err =
           visitor.Visit(const_cast<clang::Stmt *>(stmt))) {
     state = LifetimeLattice(*err);
+    return;
+  }
+
+  // Once the budget is exceeded, the error state reaches the exit block
+  // without any further work, as it is a fixed point of both `transfer` and
+  // `join`.
+  if (std::optional<std::string> err = CheckBudget(state)) {
+    exceeded_budget_ = true;
+    state = LifetimeLattice(*err);
+  }
+}
+
+std::optional<std::string>
+LifetimeAnalysis::CheckBudget(const LifetimeLattice &state) {
+  ++element_visits_;
+  if (budget_.max_element_visits != 0 &&
+      element_visits_ > budget_.max_element_visits) {
+    return absl::StrCat("analysis exceeded the limit of ",
+                        budget_.max_element_visits, " CFG element visits");
+  }
+  if (budget_.max_points_to_map_size != 0 &&
+      state.PointsTo().PointerPointsTos().size() >
+          budget_.max_points_to_map_size) {
+    return absl::StrCat("analysis exceeded the limit of ",
+                        budget_.max_points_to_map_size,
+                        " pointers in the points-to map");
   }
+  if (budget_.max_duration != std::chrono::milliseconds::zero() &&
+      std::chrono::steady_clock::now() - start_time_ > budget_.max_duration) {
+    return absl::StrCat("analysis exceeded the time limit of ",
+                        budget_.max_duration.count(), " ms");
+  }
+  return std::nullopt;
 }
 
 namespace {
@@ -380,10 +418,10 @@ TransferStmtVisitor::VisitDeclRefExpr(const clang::DeclRefExpr *decl_ref) {
   clang::QualType type = decl->getType().getCanonicalType();
 
   if (type->isReferenceType()) {
-    points_to_map_.SetExprObjectSet(
+    expr_objects_.SetExprObjectSet(
         decl_ref, points_to_map_.GetPointerPointsToSet(object));
   } else {
-    points_to_map_.SetExprObjectSet(decl_ref, {object});
+    expr_objects_.SetExprObjectSet(decl_ref, {object});
   }
 
   return std::nullopt;
@@ -392,7 +430,7 @@ TransferStmtVisitor::VisitDeclRefExpr(const clang::DeclRefExpr *decl_ref) {
 std::optional<std::string>
 TransferStmtVisitor::VisitStringLiteral(const clang::StringLiteral *strlit) {
   const Object *obj = object_repository_.CreateStaticObject(strlit->getType());
-  points_to_map_.SetExprObjectSet(strlit, {obj});
+  expr_objects_.SetExprObjectSet(strlit, {obj});
   return std::nullopt;
 }
 
@@ -410,13 +448,13 @@ TransferStmtVisitor::VisitCastExpr(const clang::CastExpr *cast) {
       //   pointer points to.
       // See also documentation for PointsToMap.
       ObjectSet points_to = points_to_map_.GetPointerPointsToSet(
-          points_to_map_.GetExprObjectSet(cast->getSubExpr()));
-      points_to_map_.SetExprObjectSet(cast, points_to);
+          expr_objects_.GetExprObjectSet(cast->getSubExpr()));
+      expr_objects_.SetExprObjectSet(cast, points_to);
     }
     break;
   }
   case clang::CK_NullToPointer: {
-    points_to_map_.SetExprObjectSet(cast, {});
+    expr_objects_.SetExprObjectSet(cast, {});
     break;
   }
   // These casts are just no-ops from a Object point of view.
@@ -431,8 +469,8 @@ TransferStmtVisitor::VisitCastExpr(const clang::CastExpr *cast) {
   case clang::CK_NoOp: {
     clang::QualType type = cast->getType().getCanonicalType();
     if (type->isPointerType() || cast->isGLValue()) {
-      points_to_map_.SetExprObjectSet(
-          cast, points_to_map_.GetExprObjectSet(cast->getSubExpr()));
+      expr_objects_.SetExprObjectSet(
+          cast, expr_objects_.GetExprObjectSet(cast->getSubExpr()));
     }
     break;
   }
@@ -443,8 +481,8 @@ TransferStmtVisitor::VisitCastExpr(const clang::CastExpr *cast) {
     // These need to be mapped to what the subexpr points to.
     // (Simple cases just work okay with this; may need to be revisited when
     // we add more inheritance support.)
-    ObjectSet points_to = points_to_map_.GetExprObjectSet(cast->getSubExpr());
-    points_to_map_.SetExprObjectSet(cast, points_to);
+    ObjectSet points_to = expr_objects_.GetExprObjectSet(cast->getSubExpr());
+    expr_objects_.SetExprObjectSet(cast, points_to);
     break;
   }
   case clang::CK_BitCast:
@@ -488,7 +526,7 @@ TransferStmtVisitor::VisitReturnStmt(const clang::ReturnStmt *return_stmt) {
   // objects with destructors. We want to find the value to be returned inside
   // the ExprWithCleanups.
   //
-  // The PointsToMap::GetExprObjectSet() function could do this but it doesn't
+  // The ExprObjectMap::GetExprObjectSet() function could do this but it doesn't
   // understand the context from which it is being called. This operation needs
   // to be done only in cases where we are leaving scope - that is, the return
   // statement. And the return statement also needs to look for initializers in
@@ -500,7 +538,7 @@ TransferStmtVisitor::VisitReturnStmt(const clang::ReturnStmt *return_stmt) {
     ret_expr = cleanups->getSubExpr();
   }
 
-  ObjectSet expr_points_to = points_to_map_.GetExprObjectSet(ret_expr);
+  ObjectSet expr_points_to = expr_objects_.GetExprObjectSet(ret_expr);
   GenerateConstraintsForAssignment(
       {object_repository_.GetReturnObject()}, expr_points_to, return_type,
       object_repository_, points_to_map_, constraints_);
@@ -519,7 +557,7 @@ TransferStmtVisitor::VisitDeclStmt(const clang::DeclStmt *decl_stmt) {
       if (var_decl->hasInit() && !var_decl->getType()->isRecordType()) {
         TransferInitializer(var_object, var_decl->getType(), object_repository_,
                             var_decl->getInit(), TargetPointeeBehavior::kIgnore,
-                            points_to_map_, constraints_);
+                            expr_objects_, points_to_map_, constraints_);
       }
     }
   }
@@ -533,7 +571,7 @@ TransferStmtVisitor::VisitUnaryOperator(const clang::UnaryOperator *op) {
     return std::nullopt;
   }
 
-  ObjectSet sub_points_to = points_to_map_.GetExprObjectSet(op->getSubExpr());
+  ObjectSet sub_points_to = expr_objects_.GetExprObjectSet(op->getSubExpr());
 
   // Maybe surprisingly, the code here doesn't do any actual address-taking or
   // dereferencing.
@@ -548,20 +586,20 @@ TransferStmtVisitor::VisitUnaryOperator(const clang::UnaryOperator *op) {
   case clang::UO_AddrOf:
     assert(!op->isGLValue());
     assert(op->getSubExpr()->isGLValue());
-    points_to_map_.SetExprObjectSet(op, sub_points_to);
+    expr_objects_.SetExprObjectSet(op, sub_points_to);
     break;
 
   case clang::UO_Deref:
     assert(op->isGLValue());
     assert(!op->getSubExpr()->isGLValue());
-    points_to_map_.SetExprObjectSet(op, sub_points_to);
+    expr_objects_.SetExprObjectSet(op, sub_points_to);
     break;
 
   case clang::UO_PostInc:
   case clang::UO_PostDec:
     assert(!op->isGLValue());
     assert(op->getSubExpr()->isGLValue());
-    points_to_map_.SetExprObjectSet(
+    expr_objects_.SetExprObjectSet(
         op, points_to_map_.GetPointerPointsToSet(sub_points_to));
     break;
 
@@ -569,7 +607,7 @@ TransferStmtVisitor::VisitUnaryOperator(const clang::UnaryOperator *op) {
   case clang::UO_PreDec:
     assert(op->isGLValue());
     assert(op->getSubExpr()->isGLValue());
-    points_to_map_.SetExprObjectSet(op, sub_points_to);
+    expr_objects_.SetExprObjectSet(op, sub_points_to);
     break;
 
   default:
@@ -588,11 +626,11 @@ std::optional<std::string> TransferStmtVisitor::VisitArraySubscriptExpr(
   // for why we don't track individual array elements.
 
   ObjectSet sub_points_to =
-      points_to_map_.GetExprObjectSet(subscript->getBase());
+      expr_objects_.GetExprObjectSet(subscript->getBase());
 
   assert(subscript->isGLValue());
   assert(!subscript->getBase()->isGLValue());
-  points_to_map_.SetExprObjectSet(subscript, sub_points_to);
+  expr_objects_.SetExprObjectSet(subscript, sub_points_to);
   return std::nullopt;
 }
 
@@ -601,14 +639,14 @@ TransferStmtVisitor::VisitBinaryOperator(const clang::BinaryOperator *op) {
   switch (op->getOpcode()) {
   case clang::BO_Assign: {
     assert(op->getLHS()->isGLValue());
-    ObjectSet lhs_points_to = points_to_map_.GetExprObjectSet(op->getLHS());
-    points_to_map_.SetExprObjectSet(op, lhs_points_to);
+    ObjectSet lhs_points_to = expr_objects_.GetExprObjectSet(op->getLHS());
+    expr_objects_.SetExprObjectSet(op, lhs_points_to);
     // Because of how we handle reference-like structs, a member access to a
     // non-reference-like field in a struct might still produce lifetimes. We
     // don't want to change points-to sets in those cases.
     if (!op->getLHS()->getType()->isPointerType())
       break;
-    ObjectSet rhs_points_to = points_to_map_.GetExprObjectSet(op->getRHS());
+    ObjectSet rhs_points_to = expr_objects_.GetExprObjectSet(op->getRHS());
     // We can overwrite (instead of extend) the destination points-to-set
     // only in very specific circumstances:
     // - We need to know unambiguously what the LHS refers to, so that we
@@ -637,11 +675,11 @@ TransferStmtVisitor::VisitBinaryOperator(const clang::BinaryOperator *op) {
     if (op->getLHS()->getType()->isPointerType() ^
         op->getRHS()->getType()->isPointerType()) {
       if (op->getLHS()->getType()->isPointerType()) {
-        points_to_map_.SetExprObjectSet(
-            op, points_to_map_.GetExprObjectSet(op->getLHS()));
+        expr_objects_.SetExprObjectSet(
+            op, expr_objects_.GetExprObjectSet(op->getLHS()));
       } else {
-        points_to_map_.SetExprObjectSet(
-            op, points_to_map_.GetExprObjectSet(op->getRHS()));
+        expr_objects_.SetExprObjectSet(
+            op, expr_objects_.GetExprObjectSet(op->getRHS()));
       }
     }
     break;
@@ -659,10 +697,10 @@ std::optional<std::string> TransferStmtVisitor::VisitConditionalOperator(
 
   if (op->isGLValue() || type->isPointerType()) {
     ObjectSet points_to_true =
-        points_to_map_.GetExprObjectSet(op->getTrueExpr());
+        expr_objects_.GetExprObjectSet(op->getTrueExpr());
     ObjectSet points_to_false =
-        points_to_map_.GetExprObjectSet(op->getFalseExpr());
-    points_to_map_.SetExprObjectSet(op, points_to_true.Union(points_to_false));
+        expr_objects_.GetExprObjectSet(op->getFalseExpr());
+    expr_objects_.SetExprObjectSet(op, points_to_true.Union(points_to_false));
   }
   return std::nullopt;
 }
@@ -685,8 +723,8 @@ TransferStmtVisitor::VisitInitListExpr(const clang::InitListExpr *init_list) {
     const Object *init_object =
         object_repository_.GetInitializedObject(init_list);
     TransferInitializer(init_object, init_list->getType(), object_repository_,
-                        init_list, TargetPointeeBehavior::kKeep, points_to_map_,
-                        constraints_);
+                        init_list, TargetPointeeBehavior::kKeep, expr_objects_,
+                        points_to_map_, constraints_);
   } else {
     // If the InitListExpr is not initializing a record object, we assume it's
     // initializing an array or a reference and hence associate the InitListExpr
@@ -700,9 +738,9 @@ TransferStmtVisitor::VisitInitListExpr(const clang::InitListExpr *init_list) {
       if (PointeeType(expr->getType()).isNull() && !expr->isGLValue()) {
         return std::nullopt;
       }
-      targets.Add(points_to_map_.GetExprObjectSet(expr));
+      targets.Add(expr_objects_.GetExprObjectSet(expr));
     }
-    points_to_map_.SetExprObjectSet(init_list, std::move(targets));
+    expr_objects_.SetExprObjectSet(init_list, std::move(targets));
   }
   return std::nullopt;
 }
@@ -711,14 +749,14 @@ std::optional<std::string> TransferStmtVisitor::VisitMaterializeTemporaryExpr(
     const clang::MaterializeTemporaryExpr *temporary_expr) {
   const Object *temp_object =
       object_repository_.GetTemporaryObject(temporary_expr);
-  points_to_map_.SetExprObjectSet(temporary_expr, {temp_object});
+  expr_objects_.SetExprObjectSet(temporary_expr, {temp_object});
   return std::nullopt;
 }
 
 std::optional<std::string>
 TransferStmtVisitor::VisitMemberExpr(const clang::MemberExpr *member) {
   ObjectSet struct_points_to =
-      points_to_map_.GetExprObjectSet(member->getBase());
+      expr_objects_.GetExprObjectSet(member->getBase());
 
   if (const auto *method =
           clang::dyn_cast<clang::CXXMethodDecl>(member->getMemberDecl())) {
@@ -729,7 +767,7 @@ TransferStmtVisitor::VisitMemberExpr(const clang::MemberExpr *member) {
     // function call, then, it's a pointer-to-member, but those aren't
     // really pointers anyway, and we'll need special treatment for them.
     if (method->isStatic()) {
-      points_to_map_.SetExprObjectSet(
+      expr_objects_.SetExprObjectSet(
           member, {object_repository_.GetDeclObject(method)});
     }
     return std::nullopt;
@@ -744,7 +782,7 @@ TransferStmtVisitor::VisitMemberExpr(const clang::MemberExpr *member) {
   if (field->getType()->isReferenceType()) {
     expr_points_to = points_to_map_.GetPointerPointsToSet(expr_points_to);
   }
-  points_to_map_.SetExprObjectSet(member, expr_points_to);
+  expr_objects_.SetExprObjectSet(member, expr_points_to);
   return std::nullopt;
 }
 
@@ -753,7 +791,7 @@ TransferStmtVisitor::VisitCXXThisExpr(const clang::CXXThisExpr *this_expr) {
   std::optional<const Object *> this_object =
       object_repository_.GetThisObject();
   assert(this_object.has_value());
-  points_to_map_.SetExprObjectSet(this_expr, ObjectSet{this_object.value()});
+  expr_objects_.SetExprObjectSet(this_expr, ObjectSet{this_object.value()});
   return std::nullopt;
 }
 
@@ -875,7 +913,7 @@ TransferStmtVisitor::VisitCallExpr(const clang::CallExpr *call) {
     }
   } else {
     const clang::Expr *callee = call->getCallee();
-    for (const auto &object : points_to_map_.GetExprObjectSet(callee)) {
+    for (const auto &object : expr_objects_.GetExprObjectSet(callee)) {
       if (const clang::FunctionDecl *func = object->GetFunc()) {
         if (auto err = add_callee_from_decl(func); err.has_value()) {
           return err;
@@ -908,15 +946,15 @@ TransferStmtVisitor::VisitCallExpr(const clang::CallExpr *call) {
           object_repository_.GetCallExprArgumentObject(call, i),
           callee.type->getParamType(callee.is_member_operator ? i - 1 : i),
           object_repository_, call->getArg(i), TargetPointeeBehavior::kKeep,
-          points_to_map_, constraints_);
+          expr_objects_, points_to_map_, constraints_);
     }
 
     std::optional<ObjectSet> this_object_set;
     if (callee.is_member_operator) {
-      this_object_set = points_to_map_.GetExprObjectSet(call->getArg(0));
+      this_object_set = expr_objects_.GetExprObjectSet(call->getArg(0));
     } else if (const auto *member_call =
                    clang::dyn_cast<clang::CXXMemberCallExpr>(call)) {
-      this_object_set = points_to_map_.GetExprObjectSet(
+      this_object_set = expr_objects_.GetExprObjectSet(
           member_call->getImplicitObjectArgument());
     }
     if (this_object_set.has_value()) {
@@ -938,7 +976,7 @@ TransferStmtVisitor::VisitCallExpr(const clang::CallExpr *call) {
     // SetExprObjectSet will assert-fail if `call` does not have a type that can
     // have an object set; this `if` guards against that.
     if (!ret_pts.empty()) {
-      points_to_map_.SetExprObjectSet(call, ret_pts);
+      expr_objects_.SetExprObjectSet(call, ret_pts);
     }
   }
   return std::nullopt;
@@ -970,8 +1008,8 @@ std::optional<std::string> TransferStmtVisitor::VisitCXXConstructExpr(
     TransferInitializer(
         object_repository_.GetCXXConstructExprArgumentObject(construct_expr, i),
         constructor->getParamDecl(i)->getType(), object_repository_,
-        construct_expr->getArg(i), TargetPointeeBehavior::kKeep, points_to_map_,
-        constraints_);
+        construct_expr->getArg(i), TargetPointeeBehavior::kKeep, expr_objects_,
+        points_to_map_, constraints_);
   }
 
   // Handle the `this` parameter, which should point to the object getting
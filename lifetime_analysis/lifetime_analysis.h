@@ -5,7 +5,10 @@
 #ifndef DEVTOOLS_RUST_CC_INTEROP_LIFETIME_ANALYSIS_LIFETIME_ANALYSIS_H_
 #define DEVTOOLS_RUST_CC_INTEROP_LIFETIME_ANALYSIS_LIFETIME_ANALYSIS_H_
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -32,13 +35,15 @@ enum class TargetPointeeBehavior {
 };
 
 // Updates constraints and points_to_map for an initialization of `dest` with
-// `init_expr`. If `pointee_behavior` is kIgnore, existing pointees of `dest`
-// will be ignored (this should be almost always the case, except when i.e.
-// initializing field variables after the fact for class constructors).
+// `init_expr`, whose object set is looked up in `expr_objects`. If
+// `pointee_behavior` is kIgnore, existing pointees of `dest` will be ignored
+// (this should be almost always the case, except when i.e. initializing field
+// variables after the fact for class constructors).
 void TransferInitializer(const Object* dest, clang::QualType type,
                          const ObjectRepository& object_repository,
                          const clang::Expr* init_expr,
                          TargetPointeeBehavior pointee_behavior,
+                         const ExprObjectMap& expr_objects,
                          PointsToMap& points_to_map,
                          LifetimeConstraints& constraints);
 
@@ -56,6 +61,18 @@ void HandlePointsToSetExtension(const ObjectSet& pointers,
 using DiagnosticReporter = std::function<clang::DiagnosticBuilder(
     clang::SourceLocation, clang::StringRef, clang::DiagnosticIDs::Level)>;
 
+// Limits on the work that the analysis of a single function may do. A limit of
+// zero means that there is no limit.
+struct AnalysisBudget {
+  // Maximum number of times that CFG elements are visited, counting each
+  // repeated visit of an element (e.g. in a loop).
+  size_t max_element_visits = 0;
+  // Maximum number of pointers in the points-to map.
+  size_t max_points_to_map_size = 0;
+  // Maximum time spent on the analysis.
+  std::chrono::milliseconds max_duration = std::chrono::milliseconds::zero();
+};
+
 class LifetimeAnalysis
     : public clang::dataflow::DataflowAnalysis<LifetimeAnalysis,
                                                LifetimeLattice> {
@@ -64,13 +81,16 @@ class LifetimeAnalysis
       const clang::FunctionDecl* func, ObjectRepository& object_repository,
       const llvm::DenseMap<const clang::FunctionDecl*,
                            FunctionLifetimesOrError>& callee_lifetimes,
-      const DiagnosticReporter& diag_reporter)
+      const DiagnosticReporter& diag_reporter,
+      const AnalysisBudget& budget = AnalysisBudget())
       : clang::dataflow::DataflowAnalysis<LifetimeAnalysis, LifetimeLattice>(
             func->getASTContext(), /*ApplyBuiltinTransfer=*/false),
         func_(func),
         object_repository_(object_repository),
         callee_lifetimes_(callee_lifetimes),
-        diag_reporter_(diag_reporter) {}
+        diag_reporter_(diag_reporter),
+        budget_(budget),
+        start_time_(std::chrono::steady_clock::now()) {}
 
   LifetimeLattice initialElement();
 
@@ -81,6 +101,15 @@ class LifetimeAnalysis
   void transfer(const clang::CFGElement& elt, LifetimeLattice& state,
                 clang::dataflow::Environment& environment);
 
+  // Returns the object sets of the expressions in the function, as of the
+  // last time they were evaluated. These are not part of the lattice; see
+  // `ExprObjectMap` for why this is sufficient.
+  const ExprObjectMap& ExprObjects() const { return expr_objects_; }
+
+  // Returns whether the analysis was stopped because it exceeded its budget.
+  // If so, the lattice is in the error state.
+  bool ExceededBudget() const { return exceeded_budget_; }
+
   // TODO(yitzhakm): remove once https://reviews.llvm.org/D143920 is committed
   // and integrated downstream.
   void transfer(const clang::CFGElement* elt, LifetimeLattice& lattice,
@@ -89,11 +118,20 @@ class LifetimeAnalysis
   }
 
  private:
+  // Returns an error message if `state` or the work done so far exceeds
+  // `budget_`.
+  std::optional<std::string> CheckBudget(const LifetimeLattice& state);
+
   const clang::FunctionDecl* func_;
   ObjectRepository& object_repository_;
   const llvm::DenseMap<const clang::FunctionDecl*, FunctionLifetimesOrError>&
       callee_lifetimes_;
   const DiagnosticReporter& diag_reporter_;
+  ExprObjectMap expr_objects_;
+  AnalysisBudget budget_;
+  std::chrono::steady_clock::time_point start_time_;
+  size_t element_visits_ = 0;
+  bool exceeded_budget_ = false;
 };
 
 }  // namespace lifetimes
@@ -7,6 +7,7 @@
 #include <llvm/ADT/DenseSet.h>
 
 #include <algorithm>
+#include <utility>
 
 #include "lifetime_annotations/lifetime.h"
 #include "lifetime_annotations/lifetime_substitutions.h"
@@ -86,8 +87,8 @@ llvm::Error LifetimeConstraints::ApplyToFunctionLifetimes(
   // Collect all "interesting" lifetimes, i.e. all lifetimes that appear in the
   // function call.
   llvm::DenseSet<Lifetime> all_interesting_lifetimes;
-  function_lifetimes.Traverse(
-      [&all_interesting_lifetimes](Lifetime l, Variance) {
+  std::as_const(function_lifetimes)
+      .Traverse([&all_interesting_lifetimes](Lifetime l, Variance) {
         all_interesting_lifetimes.insert(l);
       });
 
@@ -17,8 +17,7 @@ namespace tidy {
 namespace lifetimes {
 
 bool PointsToMap::operator==(const PointsToMap& other) const {
-  return pointer_points_tos_ == other.pointer_points_tos_ &&
-         expr_objects_ == other.expr_objects_;
+  return pointer_points_tos_ == other.pointer_points_tos_;
 }
 
 std::string PointsToMap::DebugString() const {
@@ -27,10 +26,6 @@ std::string PointsToMap::DebugString() const {
     parts.push_back(absl::StrFormat("%s -> %s", pointer->DebugString(),
                                     points_to.DebugString()));
   }
-  for (const auto& [expr, objects] : expr_objects_) {
-    parts.push_back(absl::StrFormat("%s (%p) -> %s", expr->getStmtClassName(),
-                                    expr, objects.DebugString()));
-  }
   return absl::StrJoin(parts, "\n");
 }
 
@@ -41,12 +36,6 @@ PointsToMap PointsToMap::Union(const PointsToMap& other) const {
   for (const auto& [pointer, points_to] : other.pointer_points_tos_) {
     result.pointer_points_tos_[pointer].Add(points_to);
   }
-  // TODO(mboehme): Do we even need to perform a union on expression object
-  // sets?
-  result.expr_objects_ = expr_objects_;
-  for (const auto& [expr, objects] : other.expr_objects_) {
-    result.expr_objects_[expr].Add(objects);
-  }
 
   return result;
 }
@@ -88,7 +77,27 @@ ObjectSet PointsToMap::GetPointerPointsToSet(const ObjectSet& pointers) const {
   return result;
 }
 
-ObjectSet PointsToMap::GetExprObjectSet(const clang::Expr* expr) const {
+std::vector<const Object*> PointsToMap::GetAllPointersWithLifetime(
+    Lifetime lifetime) const {
+  std::vector<const Object*> result;
+  for (const auto& [pointer, _] : pointer_points_tos_) {
+    if (pointer->GetLifetime() == lifetime) {
+      result.push_back(pointer);
+    }
+  }
+  return result;
+}
+
+std::string ExprObjectMap::DebugString() const {
+  std::vector<std::string> parts;
+  for (const auto& [expr, objects] : expr_objects_) {
+    parts.push_back(absl::StrFormat("%s (%p) -> %s", expr->getStmtClassName(),
+                                    expr, objects.DebugString()));
+  }
+  return absl::StrJoin(parts, "\n");
+}
+
+ObjectSet ExprObjectMap::GetExprObjectSet(const clang::Expr* expr) const {
   // We can't handle `ParenExpr`s like other `Expr`s because the CFG doesn't
   // contain `CFGStmt`s for them. Instead, if we encounter a `ParenExpr` here,
   // we simply return the object set for its subexpression.
@@ -109,23 +118,13 @@ ObjectSet PointsToMap::GetExprObjectSet(const clang::Expr* expr) const {
   return iter->second;
 }
 
-void PointsToMap::SetExprObjectSet(const clang::Expr* expr, ObjectSet objects) {
+void ExprObjectMap::SetExprObjectSet(const clang::Expr* expr,
+                                     ObjectSet objects) {
   assert(expr->isGLValue() || expr->getType()->isPointerType() ||
          expr->getType()->isArrayType() || expr->getType()->isBuiltinType());
   expr_objects_[expr] = std::move(objects);
 }
 
-std::vector<const Object*> PointsToMap::GetAllPointersWithLifetime(
-    Lifetime lifetime) const {
-  std::vector<const Object*> result;
-  for (const auto& [pointer, _] : pointer_points_tos_) {
-    if (pointer->GetLifetime() == lifetime) {
-      result.push_back(pointer);
-    }
-  }
-  return result;
-}
-
 }  // namespace lifetimes
 }  // namespace tidy
 }  // namespace clang
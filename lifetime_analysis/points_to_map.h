@@ -18,22 +18,9 @@ namespace lifetimes {
 // Maintains the points-to sets needed for the analysis of a function.
 // A `PointsToMap` stores points-to sets for
 // - Objects of reference-like type
-// - Expressions that are prvalues of pointer type or glvalues (glvalues are,
-//   in spirit, references to the object they refer to.)
 // - The function's return value, if it is of reference-like type
-//
-// Note that the relationship between an expression's type and the type of the
-// objects associated with it depends on whether the expression is a glvalue or
-// prvalue:
-// - glvalue expressions are associated with the object that is identified by
-//   the glvalue. This means that the object has the same type as the glvalue
-//   expression.
-// - prvalue expressions of pointer type as are associated with the object that
-//   the pointer points to. This means that if the prvalue expression has type
-//   `T *`, the object has type `T`.
-// The PointsToMap class does not enforce these type relationships because we
-// intend to allow type punning (at least within the implementations of
-// functions).
+// The object sets associated with expressions are kept separately, in an
+// `ExprObjectMap`.
 class PointsToMap {
  public:
   PointsToMap() = default;
@@ -56,7 +43,7 @@ class PointsToMap {
   // Returns a `PointsToMap` containing the union of mappings from this map and
   // `other`.
   // If both this map and `other` associate a points-to set with the same
-  // entity, the returned map associates that entity with the union of the
+  // pointer, the returned map associates that pointer with the union of the
   // corresponding points-to sets.
   PointsToMap Union(const PointsToMap& other) const;
 
@@ -79,6 +66,49 @@ class PointsToMap {
   // or an empty set if none of the pointers is associated with a points-to set.
   ObjectSet GetPointerPointsToSet(const ObjectSet& pointers) const;
 
+  // Returns all the pointers (not objects) with the given `lifetime`.
+  std::vector<const Object*> GetAllPointersWithLifetime(
+      Lifetime lifetime) const;
+
+ private:
+  llvm::DenseMap<const Object*, ObjectSet> pointer_points_tos_;
+};
+
+// Associates expressions with the objects they refer to. This covers
+// expressions that are prvalues of pointer type or glvalues (glvalues are, in
+// spirit, references to the object they refer to.)
+//
+// Unlike a `PointsToMap`, an `ExprObjectMap` is not part of the lattice but
+// flow-insensitive: there is one for the whole analysis of a function. This
+// works because every expression is evaluated in exactly one CFG block, and
+// its object set is computed from that block's input state every time the
+// block is (re-)visited, so the most recent object set is always the one
+// for the current state of the analysis.
+//
+// Note that the relationship between an expression's type and the type of the
+// objects associated with it depends on whether the expression is a glvalue or
+// prvalue:
+// - glvalue expressions are associated with the object that is identified by
+//   the glvalue. This means that the object has the same type as the glvalue
+//   expression.
+// - prvalue expressions of pointer type as are associated with the object that
+//   the pointer points to. This means that if the prvalue expression has type
+//   `T *`, the object has type `T`.
+// The ExprObjectMap class does not enforce these type relationships because we
+// intend to allow type punning (at least within the implementations of
+// functions).
+class ExprObjectMap {
+ public:
+  ExprObjectMap() = default;
+
+  ExprObjectMap(const ExprObjectMap&) = default;
+  ExprObjectMap(ExprObjectMap&&) = default;
+  ExprObjectMap& operator=(const ExprObjectMap&) = default;
+  ExprObjectMap& operator=(ExprObjectMap&&) = default;
+
+  // Returns a human-readable representation of this object.
+  std::string DebugString() const;
+
   // Returns the object set associated with `expr`.
   // `expr` must previously have been associated with an object set through
   // a call to SetExprObjectSet(), and the function asserts that this is the
@@ -87,15 +117,11 @@ class PointsToMap {
   // expressions.
   ObjectSet GetExprObjectSet(const clang::Expr* expr) const;
 
-  // Associates `expr` with the given object set.
+  // Associates `expr` with the given object set, replacing the object set
+  // that `expr` was previously associated with (if any).
   void SetExprObjectSet(const clang::Expr* expr, ObjectSet objects);
 
-  // Returns all the pointers (not objects) with the given `lifetime`.
-  std::vector<const Object*> GetAllPointersWithLifetime(
-      Lifetime lifetime) const;
-
  private:
-  llvm::DenseMap<const Object*, ObjectSet> pointer_points_tos_;
   llvm::DenseMap<const clang::Expr*, ObjectSet> expr_objects_;
 };
 
@@ -28,58 +28,39 @@ const clang::CallExpr* getFirstCallExpr(const clang::ASTContext& ast_context) {
 
 TEST(PointsToMapTest, Equality) {
   runOnCodeWithLifetimeHandlers(
-      "int *return_int_ptr();"
-      "int* p = return_int_ptr();",
+      "",
       [](const clang::ASTContext& ast_context,
          const LifetimeAnnotationContext&) {
         Object p1(Lifetime::CreateLocal(), ast_context.IntTy);
         Object p2(Lifetime::CreateLocal(), ast_context.IntTy);
         Object p3(Lifetime::CreateLocal(), ast_context.IntTy);
-        const clang::CallExpr* expr = getFirstCallExpr(ast_context);
 
-        {
-          PointsToMap map1, map2;
-          map1.SetPointerPointsToSet(&p1, {&p2});
-          map2.SetPointerPointsToSet(&p1, {&p3});
-          EXPECT_EQ(map1, PointsToMap(map1));
-          EXPECT_NE(map1, PointsToMap());
-          EXPECT_NE(map1, map2);
-        }
-
-        {
-          PointsToMap map1, map2;
-          map1.SetExprObjectSet(expr, {&p1});
-          map2.SetExprObjectSet(expr, {&p2});
-          EXPECT_EQ(map1, PointsToMap(map1));
-          EXPECT_NE(map1, PointsToMap());
-          EXPECT_NE(map1, map2);
-        }
+        PointsToMap map1, map2;
+        map1.SetPointerPointsToSet(&p1, {&p2});
+        map2.SetPointerPointsToSet(&p1, {&p3});
+        EXPECT_EQ(map1, PointsToMap(map1));
+        EXPECT_NE(map1, PointsToMap());
+        EXPECT_NE(map1, map2);
       },
       {});
 }
 
 TEST(PointsToMapTest, Union) {
   runOnCodeWithLifetimeHandlers(
-      "int *return_int_ptr();"
-      "int* p = return_int_ptr();",
+      "",
       [](const clang::ASTContext& ast_context,
          const LifetimeAnnotationContext&) {
         Object p1(Lifetime::CreateLocal(), ast_context.IntTy);
         Object p2(Lifetime::CreateLocal(), ast_context.IntTy);
         Object p3(Lifetime::CreateLocal(), ast_context.IntTy);
-        const clang::CallExpr* expr = getFirstCallExpr(ast_context);
 
         PointsToMap map1, map2;
         map1.SetPointerPointsToSet(&p1, {&p2});
         map2.SetPointerPointsToSet(&p1, {&p3});
 
-        map1.SetExprObjectSet(expr, {&p2});
-        map2.SetExprObjectSet(expr, {&p3});
-
         PointsToMap union_map = map1.Union(map2);
 
         EXPECT_EQ(union_map.GetPointerPointsToSet(&p1), ObjectSet({&p2, &p3}));
-        EXPECT_EQ(union_map.GetExprObjectSet(expr), ObjectSet({&p2, &p3}));
       },
       {});
 }
@@ -131,19 +112,24 @@ TEST(PointsToMapTest, ExtendPointerPointsToSet) {
       {});
 }
 
-TEST(PointsToMapTest, GetExprObjectSet) {
+TEST(ExprObjectMapTest, GetExprObjectSet) {
   runOnCodeWithLifetimeHandlers(
       "int *return_int_ptr();"
       "int* p = return_int_ptr();",
       [](const clang::ASTContext& ast_context,
          const LifetimeAnnotationContext&) {
         Object p1(Lifetime::CreateLocal(), ast_context.IntTy);
+        Object p2(Lifetime::CreateLocal(), ast_context.IntTy);
         const clang::CallExpr* expr = getFirstCallExpr(ast_context);
 
-        PointsToMap map;
+        ExprObjectMap map;
 
         map.SetExprObjectSet(expr, {&p1});
         EXPECT_EQ(map.GetExprObjectSet(expr), ObjectSet({&p1}));
+
+        // Setting the object set again replaces it.
+        map.SetExprObjectSet(expr, {&p2});
+        EXPECT_EQ(map.GetExprObjectSet(expr), ObjectSet({&p2}));
       },
       {});
 }
@@ -19,7 +19,9 @@
 #include "clang/ASTMatchers/ASTMatchFinder.h"
 #include "clang/ASTMatchers/ASTMatchers.h"
 #include "clang/Analysis/CFG.h"
+#include "clang/Basic/Diagnostic.h"
 #include "clang/Lex/Lexer.h"
+#include "clang/Sema/Sema.h"
 #include "clang/Tooling/Tooling.h"
 #include "clang/Tooling/Transformer/Stencil.h"
 #include "clang/Tooling/Transformer/Transformer.h"
@@ -52,6 +54,65 @@ class TranslationUnitMatcherCallback : public MatchFinder::MatchCallback {
 
 }  // namespace
 
+llvm::Expected<clang::FunctionDecl*> InstantiateWithPlaceholders(
+    clang::Sema& sema, clang::FunctionTemplateDecl* tmpl) {
+  clang::ASTContext& context = sema.getASTContext();
+  clang::TranslationUnitDecl* tu = context.getTranslationUnitDecl();
+  clang::SourceLocation loc = tmpl->getLocation();
+  std::string func_name = tmpl->getNameAsString();
+
+  llvm::SmallVector<clang::TemplateArgument, 2> arguments;
+  for (clang::NamedDecl* param : *tmpl->getTemplateParameters()) {
+    if (!llvm::isa<clang::TemplateTypeParmDecl>(param) ||
+        param->isTemplateParameterPack()) {
+      return llvm::createStringError(
+          llvm::inconvertibleErrorCode(),
+          absl::StrCat("Cannot create a placeholder for template parameter '",
+                       param->getNameAsString(), "' of '", func_name, "'"));
+    }
+    // The placeholder classes are implicit and therefore not found by name
+    // lookup, so their names only need to be readable in debug output.
+    auto* placeholder = clang::CXXRecordDecl::Create(
+        context, clang::TTK_Struct, tu, loc, loc,
+        &context.Idents.get(absl::StrCat(func_name, "_type_placeholder_",
+                                         arguments.size())));
+    placeholder->setImplicit();
+    placeholder->startDefinition();
+    placeholder->completeDefinition();
+    tu->addHiddenDecl(placeholder);
+    arguments.push_back(
+        clang::TemplateArgument(context.getRecordType(placeholder)));
+  }
+
+  // Errors in the instantiation (e.g. because the body uses members that the
+  // placeholders don't have) must not be reported as errors in the user's
+  // code. With all diagnostics suppressed, they are still counted by the
+  // trap, but not by the `DiagnosticsEngine` itself.
+  clang::DiagnosticsEngine& diagnostics = sema.getDiagnostics();
+  bool suppress_all_diagnostics = diagnostics.getSuppressAllDiagnostics();
+  diagnostics.setSuppressAllDiagnostics(true);
+  clang::DiagnosticErrorTrap trap(diagnostics);
+
+  clang::FunctionDecl* instantiation = sema.InstantiateFunctionDeclaration(
+      tmpl, clang::TemplateArgumentList::CreateCopy(context, arguments), loc);
+  if (instantiation) {
+    sema.InstantiateFunctionDefinition(loc, instantiation,
+                                       /*Recursive=*/true,
+                                       /*DefinitionRequired=*/true);
+  }
+
+  diagnostics.setSuppressAllDiagnostics(suppress_all_diagnostics);
+
+  if (!instantiation || trap.hasErrorOccurred() ||
+      !instantiation->hasBody()) {
+    return llvm::createStringError(
+        llvm::inconvertibleErrorCode(),
+        absl::StrCat("Cannot instantiate '", func_name,
+                     "' with placeholder types"));
+  }
+  return instantiation;
+}
+
 llvm::Expected<GeneratedCode> GenerateTemplateInstantiationCode(
     const clang::TranslationUnitDecl* tu,
     const llvm::DenseMap<clang::FunctionTemplateDecl*,
@@ -9,6 +9,8 @@
 #include <string>
 
 #include "clang/AST/Decl.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/Sema/Sema.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/Error.h"
 
@@ -21,6 +23,18 @@ struct GeneratedCode {
   std::string code;
 };
 
+// Instantiates the function template `tmpl` in the `ASTContext` of `sema`,
+// using newly created placeholder classes as the template arguments, and
+// returns the instantiation (including its definition).
+// This is the in-AST alternative to `GenerateTemplateInstantiationCode()` and
+// `RunToolOnCodeWithOverlay()`, which reparse the whole translation unit.
+// `sema` must still be alive, i.e. this needs to be called from within
+// `ASTConsumer::HandleTranslationUnit()` or earlier.
+// Only type template parameters are supported. Diagnostics emitted while
+// instantiating are suppressed; if any error occurs, an error is returned.
+llvm::Expected<clang::FunctionDecl*> InstantiateWithPlaceholders(
+    clang::Sema& sema, clang::FunctionTemplateDecl* tmpl);
+
 // Generates a source code that includes the original code for `tu`
 // and also has explicit template instantiation code with placeholder
 // classes for the templates in `templates`.
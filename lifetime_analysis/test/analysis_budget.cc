@@ -0,0 +1,69 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Tests for limiting the work done by the analysis of a function.
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "lifetime_analysis/test/lifetime_analysis_test.h"
+
+namespace clang {
+namespace tidy {
+namespace lifetimes {
+namespace {
+
+TEST_F(LifetimeAnalysisTest, WithinBudget) {
+  GetLifetimesOptions options;
+  options.budget.max_element_visits = 1000;
+  options.budget.max_points_to_map_size = 1000;
+  EXPECT_THAT(GetLifetimes(R"(
+    int* target(int* a, int* b) {
+      return a;
+    }
+  )",
+                           options),
+              LifetimesAre({{"target", "a, b -> a"}}));
+}
+
+TEST_F(LifetimeAnalysisTest, ExceededElementVisitsFallsBackToSameLifetimes) {
+  GetLifetimesOptions options;
+  options.budget.max_element_visits = 1;
+  EXPECT_THAT(GetLifetimes(R"(
+    int* target(int* a, int* b) {
+      return a;
+    }
+  )",
+                           options),
+              LifetimesAre({{"target", "a, a -> a"}}));
+}
+
+TEST_F(LifetimeAnalysisTest, ExceededPointsToMapSizeFallsBackToSameLifetimes) {
+  GetLifetimesOptions options;
+  options.budget.max_points_to_map_size = 1;
+  EXPECT_THAT(GetLifetimes(R"(
+    int* target(int* a, int* b) {
+      return a;
+    }
+  )",
+                           options),
+              LifetimesAre({{"target", "a, a -> a"}}));
+}
+
+TEST_F(LifetimeAnalysisTest, ExceededBudgetFallsBackToAnnotations) {
+  GetLifetimesOptions options;
+  options.budget.max_element_visits = 1;
+  EXPECT_THAT(GetLifetimes(R"(
+    [[clang::annotate("lifetimes", "a, b -> b")]]
+    int* target(int* a, int* b) {
+      return a;
+    }
+  )",
+                           options),
+              LifetimesAre({{"target", "a, b -> b"}}));
+}
+
+}  // namespace
+}  // namespace lifetimes
+}  // namespace tidy
+}  // namespace clang
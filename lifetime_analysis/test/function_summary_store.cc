@@ -0,0 +1,242 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Tests for reusing function summaries across analyses.
+
+#include "lifetime_analysis/function_summary_store.h"
+
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "lifetime_analysis/test/lifetime_analysis_test.h"
+
+namespace clang {
+namespace tidy {
+namespace lifetimes {
+namespace {
+
+class FunctionSummaryStoreTest : public LifetimeAnalysisTest {
+ protected:
+  FunctionSummaryStoreTest()
+      : store_(absl::StrCat(
+            testing::TempDir(), "/",
+            testing::UnitTest::GetInstance()->current_test_info()->name())) {
+    options_.summary_store = &store_;
+  }
+
+  FunctionSummaryStore store_;
+  GetLifetimesOptions options_;
+};
+
+TEST_F(FunctionSummaryStoreTest, ReusesSummaries) {
+  constexpr llvm::StringRef kCode = R"(
+    int* f(int* a) {
+      return a;
+    }
+    int* target(int* a, int* b) {
+      return f(b);
+    }
+  )";
+  EXPECT_THAT(GetLifetimes(kCode, options_),
+              LifetimesAre({{"f", "a -> a"}, {"target", "a, b -> b"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 2);
+
+  EXPECT_THAT(GetLifetimes(kCode, options_),
+              LifetimesAre({{"f", "a -> a"}, {"target", "a, b -> b"}}));
+  EXPECT_EQ(store_.hits(), 2);
+  EXPECT_EQ(store_.misses(), 2);
+}
+
+TEST_F(FunctionSummaryStoreTest, ChangedBodyIsAnalyzedAgain) {
+  constexpr llvm::StringRef kCode = R"(
+    int* f(int* a) {
+      return a;
+    }
+    int* target(int* a, int* b) {
+      return f(b);
+    }
+  )";
+  EXPECT_THAT(GetLifetimes(kCode, options_),
+              LifetimesAre({{"f", "a -> a"}, {"target", "a, b -> b"}}));
+  EXPECT_EQ(store_.misses(), 2);
+
+  // `f` has a different body, but the same lifetimes, so the summary of
+  // `target` can still be reused.
+  constexpr llvm::StringRef kCodeWithNewBody = R"(
+    int* f(int* a) {
+      int* p = a;
+      return p;
+    }
+    int* target(int* a, int* b) {
+      return f(b);
+    }
+  )";
+  EXPECT_THAT(GetLifetimes(kCodeWithNewBody, options_),
+              LifetimesAre({{"f", "a -> a"}, {"target", "a, b -> b"}}));
+  EXPECT_EQ(store_.hits(), 1);
+  EXPECT_EQ(store_.misses(), 3);
+
+  // `f` has different lifetimes, so `target` needs to be analyzed again.
+  constexpr llvm::StringRef kCodeWithNewLifetimes = R"(
+    int* f(int* a) {
+      static int i = 42;
+      return &i;
+    }
+    int* target(int* a, int* b) {
+      return f(b);
+    }
+  )";
+  EXPECT_THAT(
+      GetLifetimes(kCodeWithNewLifetimes, options_),
+      LifetimesAre({{"f", "a -> static"}, {"target", "a, b -> static"}}));
+  EXPECT_EQ(store_.hits(), 1);
+  EXPECT_EQ(store_.misses(), 5);
+}
+
+TEST_F(FunctionSummaryStoreTest, ReusesMethodSummaries) {
+  constexpr llvm::StringRef kCode = R"(
+    struct [[clang::annotate("lifetime_params", "a")]] S {
+      [[clang::annotate("member_lifetimes", "a")]]
+      int* a;
+      int* f() { return a; }
+    };
+  )";
+  EXPECT_THAT(GetLifetimes(kCode, options_),
+              LifetimesAre({{"S::f", "(a, b): -> a"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 1);
+
+  EXPECT_THAT(GetLifetimes(kCode, options_),
+              LifetimesAre({{"S::f", "(a, b): -> a"}}));
+  EXPECT_EQ(store_.hits(), 1);
+  EXPECT_EQ(store_.misses(), 1);
+}
+
+TEST_F(FunctionSummaryStoreTest, ChangedRecordLifetimeParamsAreAnalyzedAgain) {
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a")]] S {
+      [[clang::annotate("member_lifetimes", "a")]]
+      int* a;
+      int* f() { return a; }
+    };
+  )",
+                           options_),
+              LifetimesAre({{"S::f", "(a, b): -> a"}}));
+  EXPECT_EQ(store_.misses(), 1);
+
+  // The body of `S::f` is the same, but the lifetime parameters of `S` are
+  // not.
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a", "b")]] S {
+      [[clang::annotate("member_lifetimes", "b")]]
+      int* a;
+      int* f() { return a; }
+    };
+  )",
+                           options_),
+              LifetimesAre({{"S::f", "([a, b], c): -> b"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 2);
+}
+
+TEST_F(FunctionSummaryStoreTest, ChangedFieldLifetimesAreAnalyzedAgain) {
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a", "b")]] S {
+      [[clang::annotate("member_lifetimes", "a")]]
+      int* p;
+    };
+    int* target(S s) {
+      return s.p;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"target", "([a, b]) -> a"}}));
+  EXPECT_EQ(store_.misses(), 1);
+
+  // The definition of `target` is the same, but the field it returns now has a
+  // different lifetime.
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a", "b")]] S {
+      [[clang::annotate("member_lifetimes", "b")]]
+      int* p;
+    };
+    int* target(S s) {
+      return s.p;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"target", "([a, b]) -> b"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 2);
+}
+
+TEST_F(FunctionSummaryStoreTest, ChangedNestedFieldLifetimesAreAnalyzedAgain) {
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a", "b")]] T {
+      [[clang::annotate("member_lifetimes", "a", "b")]]
+      int** x;
+    };
+    struct [[clang::annotate("lifetime_params", "a", "b")]] S {
+      [[clang::annotate("member_lifetimes", "b", "a")]]
+      T t;
+    };
+    int** target(S s) {
+      return s.t.x;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"target", "([a, b]) -> (b, a)"}}));
+  EXPECT_EQ(store_.misses(), 1);
+
+  // Only the definition of `T`, which `target` reaches through `S`, changes.
+  EXPECT_THAT(GetLifetimes(R"(
+    struct [[clang::annotate("lifetime_params", "a", "b")]] T {
+      [[clang::annotate("member_lifetimes", "b", "a")]]
+      int** x;
+    };
+    struct [[clang::annotate("lifetime_params", "a", "b")]] S {
+      [[clang::annotate("member_lifetimes", "b", "a")]]
+      T t;
+    };
+    int** target(S s) {
+      return s.t.x;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"target", "([a, b]) -> (a, b)"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 2);
+}
+
+TEST_F(FunctionSummaryStoreTest, ChangedLifetimeElisionIsAnalyzedAgain) {
+  EXPECT_THAT(GetLifetimes(R"(
+    int* f(int* a) {
+      return a;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"f", "a -> a"}}));
+  EXPECT_EQ(store_.misses(), 1);
+
+  // The definition of `f` is the same, but lifetime elision is now enabled
+  // for it.
+  EXPECT_THAT(GetLifetimes(R"(
+    #pragma clang lifetime_elision
+    int* f(int* a) {
+      return a;
+    }
+  )",
+                           options_),
+              LifetimesAre({{"f", "a -> a"}}));
+  EXPECT_EQ(store_.hits(), 0);
+  EXPECT_EQ(store_.misses(), 2);
+}
+
+}  // namespace
+}  // namespace lifetimes
+}  // namespace tidy
+}  // namespace clang
@@ -13,7 +13,26 @@ namespace tidy {
 namespace lifetimes {
 namespace {
 
-TEST_F(LifetimeAnalysisTest, FunctionTemplatePtr) {
+// Runs each test both with the `Sema` that built the translation unit, which
+// instantiates the templates in place, and without it, which parses the
+// translation unit again (as clang-tidy does).
+class FunctionTemplatePlaceholderTest
+    : public LifetimeAnalysisTest,
+      public testing::WithParamInterface</*with_sema=*/bool> {
+ protected:
+  NamedFuncLifetimes GetLifetimesWithPlaceholder(llvm::StringRef source_code) {
+    return LifetimeAnalysisTest::GetLifetimesWithPlaceholder(source_code,
+                                                             GetParam());
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(WithAndWithoutSema, FunctionTemplatePlaceholderTest,
+                         testing::Bool(),
+                         [](const testing::TestParamInfo<bool>& info) {
+                           return info.param ? "WithSema" : "WithoutSema";
+                         });
+
+TEST_P(FunctionTemplatePlaceholderTest, FunctionTemplatePtr) {
   EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
     template <typename T>
     T* target(T* t) {
@@ -23,7 +42,7 @@ TEST_F(LifetimeAnalysisTest, FunctionTemplatePtr) {
               LifetimesAre({{"target", "a -> a"}}));
 }
 
-TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithTwoArgs) {
+TEST_P(FunctionTemplatePlaceholderTest, FunctionTemplatePtrWithTwoArgs) {
   EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
     template <typename T, typename U>
     T* target(T* t, U* u1, U& u2) {
@@ -34,7 +53,8 @@ TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithTwoArgs) {
               LifetimesAre({{"target", "a, b, c -> a"}}));
 }
 
-TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithTemplatedStruct) {
+TEST_P(FunctionTemplatePlaceholderTest,
+       FunctionTemplatePtrWithTemplatedStruct) {
   EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
     template <typename T>
     struct S {
@@ -49,7 +69,8 @@ TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithTemplatedStruct) {
               LifetimesAre({{"target", "(a, b) -> a"}}));
 }
 
-TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithMultipleFunctions) {
+TEST_P(FunctionTemplatePlaceholderTest,
+       FunctionTemplatePtrWithMultipleFunctions) {
   // The code has both template and non-template functions/code.
   EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
     static int x = 3;
@@ -74,6 +95,38 @@ TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithMultipleFunctions) {
                   {{"target", "a -> a"}, {"target2", "a -> a"}, {"foo", "a"}}));
 }
 
+TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithInvalidPlaceholder) {
+  // The placeholder type has no members, so `target` can't be instantiated
+  // with it. This must not be reported as an error in the code itself.
+  // (Only the `Sema` path reports this per template; see
+  // `FunctionTemplatePlaceholderTest` for the tests that cover both paths.)
+  EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
+    template <typename T>
+    int* target(T* t) {
+      return t->member;
+    }
+    int* f(int* a) {
+      return a;
+    }
+  )"),
+              LifetimesAre({{"f", "a -> a"},
+                            {"target",
+                             "ERROR: Cannot instantiate 'target' with "
+                             "placeholder types"}}));
+}
+
+TEST_F(LifetimeAnalysisTest, FunctionTemplatePtrWithNonTypeParameter) {
+  EXPECT_THAT(GetLifetimesWithPlaceholder(R"(
+    template <int N>
+    int* target(int* a) {
+      return a + N;
+    }
+  )"),
+              LifetimesAre({{"target",
+                             "ERROR: Cannot create a placeholder for template "
+                             "parameter 'N' of 'target'"}}));
+}
+
 TEST_F(LifetimeAnalysisTest, FunctionTemplateCall) {
   EXPECT_THAT(GetLifetimes(R"(
     template <typename T>
@@ -82,8 +82,10 @@ NamedFuncLifetimes LifetimeAnalysisTest::GetLifetimes(
   NamedFuncLifetimes tu_lifetimes;
 
   auto test = [&tu_lifetimes, &options, this](
-                  clang::ASTContext& ast_context,
+                  clang::Sema& sema,
                   const LifetimeAnnotationContext& lifetime_context) {
+    clang::ASTContext& ast_context = sema.getASTContext();
+
     // This will get called even if the code contains compilation errors.
     // So we need to check to avoid performing an analysis on code that
     // doesn't compile.
@@ -132,11 +134,14 @@ NamedFuncLifetimes LifetimeAnalysisTest::GetLifetimes(
       AnalyzeTranslationUnitWithTemplatePlaceholder(
           ast_context.getTranslationUnitDecl(), lifetime_context,
           result_callback,
-          /*diag_reporter=*/{}, &func_ptr_debug_info_map);
+          /*diag_reporter=*/{}, &func_ptr_debug_info_map,
+          options.summary_store, options.with_sema ? &sema : nullptr,
+          options.budget);
     } else {
       analysis_result = AnalyzeTranslationUnit(
           ast_context.getTranslationUnitDecl(), lifetime_context,
-          /*diag_reporter=*/{}, &func_ptr_debug_info_map);
+          /*diag_reporter=*/{}, &func_ptr_debug_info_map,
+          options.summary_store, options.budget);
 
       for (const auto& [func, lifetimes_or_error] : analysis_result) {
         result_callback(func, lifetimes_or_error);
@@ -169,9 +174,10 @@ NamedFuncLifetimes LifetimeAnalysisTest::GetLifetimes(
 }
 
 NamedFuncLifetimes LifetimeAnalysisTest::GetLifetimesWithPlaceholder(
-    llvm::StringRef source_code) {
+    llvm::StringRef source_code, bool with_sema) {
   GetLifetimesOptions options;
   options.with_template_placeholder = true;
+  options.with_sema = with_sema;
   return GetLifetimes(source_code, options);
 }
 
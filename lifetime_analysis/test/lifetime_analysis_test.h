@@ -10,6 +10,7 @@
 #include "gtest/gtest.h"
 #include "absl/container/flat_hash_map.h"
 #include "lifetime_analysis/analyze.h"
+#include "lifetime_analysis/function_summary_store.h"
 #include "lifetime_annotations/test/named_func_lifetimes.h"
 
 namespace clang {
@@ -24,16 +25,25 @@ class LifetimeAnalysisTest : public testing::Test {
 
   struct GetLifetimesOptions {
     GetLifetimesOptions()
-        : with_template_placeholder(false), include_implicit_methods(false) {}
+        : with_template_placeholder(false),
+          with_sema(true),
+          include_implicit_methods(false),
+          summary_store(nullptr) {}
     bool with_template_placeholder;
+    // Whether templates are instantiated with placeholders using the `Sema`
+    // that built the translation unit, instead of parsing it again.
+    bool with_sema;
     bool include_implicit_methods;
+    FunctionSummaryStore* summary_store;
+    AnalysisBudget budget;
   };
 
   NamedFuncLifetimes GetLifetimes(
       llvm::StringRef source_code,
       const GetLifetimesOptions& options = GetLifetimesOptions());
 
-  NamedFuncLifetimes GetLifetimesWithPlaceholder(llvm::StringRef source_code);
+  NamedFuncLifetimes GetLifetimesWithPlaceholder(llvm::StringRef source_code,
+                                                 bool with_sema = true);
 
   void AnalyzeBrokenCode() { analyze_broken_code_ = true; }
 
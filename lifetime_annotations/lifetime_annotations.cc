@@ -315,11 +315,55 @@ llvm::Expected<FunctionLifetimes> GetLifetimeAnnotations(
       source_manager.getFileID(func->getSourceRange().getBegin());
   bool elision_enabled = context.lifetime_elision_files.contains(file_id);
 
-  LifetimeSymbolTable throw_away_symbol_table;
-  if (!symbol_table) {
-    symbol_table = &throw_away_symbol_table;
+  // The result depends on the lifetimes already declared in `symbol_table`.
+  if (symbol_table && !symbol_table->GetMapping().empty()) {
+    return GetLifetimeAnnotationsInternal(func, *symbol_table, elision_enabled);
+  }
+
+  LifetimeAnnotationCache& cache = *context.annotation_cache;
+  const LifetimeAnnotationCache::Entry* entry =
+      cache.Lookup(func, elision_enabled);
+  if (!entry) {
+    LifetimeAnnotationCache::Entry new_entry;
+    llvm::Expected<FunctionLifetimes> lifetimes =
+        GetLifetimeAnnotationsInternal(func, new_entry.symbol_table,
+                                       elision_enabled);
+    if (lifetimes) {
+      new_entry.lifetimes = std::move(*lifetimes);
+    } else {
+      new_entry.error = llvm::toString(lifetimes.takeError());
+    }
+    entry = &cache.Insert(func, elision_enabled, std::move(new_entry));
+  }
+
+  if (symbol_table) {
+    *symbol_table = entry->symbol_table;
   }
-  return GetLifetimeAnnotationsInternal(func, *symbol_table, elision_enabled);
+  if (!entry->lifetimes.has_value()) {
+    return llvm::createStringError(llvm::inconvertibleErrorCode(),
+                                   entry->error);
+  }
+  return *entry->lifetimes;
+}
+
+const LifetimeAnnotationCache::Entry* LifetimeAnnotationCache::Lookup(
+    const clang::FunctionDecl* func, bool elision_enabled) {
+  if (&func->getASTContext() != ast_context_) {
+    entries_.clear();
+    ast_context_ = &func->getASTContext();
+  }
+  auto iter = entries_.find({func, elision_enabled});
+  if (iter == entries_.end()) {
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  return &iter->second;
+}
+
+const LifetimeAnnotationCache::Entry& LifetimeAnnotationCache::Insert(
+    const clang::FunctionDecl* func, bool elision_enabled, Entry entry) {
+  return entries_[{func, elision_enabled}] = std::move(entry);
 }
 
 llvm::Expected<FunctionLifetimes> ParseLifetimeAnnotations(
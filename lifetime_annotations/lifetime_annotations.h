@@ -6,21 +6,63 @@
 #define CRUBIT_LIFETIME_ANNOTATIONS_LIFETIME_ANNOTATIONS_H_
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
 
 #include "lifetime_annotations/function_lifetimes.h"
 #include "lifetime_annotations/lifetime_symbol_table.h"
+#include "clang/AST/ASTContext.h"
 #include "clang/AST/Decl.h"
 #include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/Error.h"
 
 namespace clang {
 namespace tidy {
 namespace lifetimes {
 
+// Caches the results of GetLifetimeAnnotations(), so that the annotations on a
+// function declaration are only evaluated once.
+// The cache holds results for a single ASTContext; it is cleared when it is
+// used with a function from a different ASTContext.
+class LifetimeAnnotationCache {
+ public:
+  struct Entry {
+    // The annotated lifetimes, or nullopt if they could not be determined.
+    std::optional<FunctionLifetimes> lifetimes;
+    // The error message if `lifetimes` is nullopt.
+    std::string error;
+    // The names of the lifetimes in `lifetimes`.
+    LifetimeSymbolTable symbol_table;
+  };
+
+  // Returns the cached result for `func`, or null if there is none.
+  const Entry* Lookup(const clang::FunctionDecl* func, bool elision_enabled);
+
+  // Caches `entry` as the result for `func` and returns the cached entry.
+  const Entry& Insert(const clang::FunctionDecl* func, bool elision_enabled,
+                      Entry entry);
+
+  // Number of lookups that did or did not find a cached result.
+  int hits() const { return hits_; }
+  int misses() const { return misses_; }
+
+ private:
+  const clang::ASTContext* ast_context_ = nullptr;
+  llvm::DenseMap<std::pair<const clang::FunctionDecl*, bool>, Entry> entries_;
+  int hits_ = 0;
+  int misses_ = 0;
+};
+
 // Context that is required to obtain lifetime annotations for a function.
 struct LifetimeAnnotationContext {
   // Files in which the `lifetime_elision` pragma was specified.
   llvm::DenseSet<clang::FileID> lifetime_elision_files;
+
+  // Results of previous GetLifetimeAnnotations() calls with this context.
+  std::shared_ptr<LifetimeAnnotationCache> annotation_cache =
+      std::make_shared<LifetimeAnnotationCache>();
 };
 
 // Returns the lifetimes annotated on `func`.
@@ -33,6 +75,10 @@ struct LifetimeAnnotationContext {
 // rules were not applicable.
 // The names of annotated function lifetimes as well as autogenerated names for
 // elided lifetimes are added to `symbol_table`.
+// Results are cached in `context.annotation_cache`, so repeated calls for the
+// same function return the same lifetimes. Calls with a non-empty
+// `symbol_table` are not cached, as their result depends on the lifetimes
+// already declared in it.
 llvm::Expected<FunctionLifetimes> GetLifetimeAnnotations(
     const clang::FunctionDecl* func, const LifetimeAnnotationContext& context,
     LifetimeSymbolTable* symbol_table = nullptr);
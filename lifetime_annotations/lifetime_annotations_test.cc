@@ -729,6 +729,50 @@ TEST_F(LifetimeAnnotationsTest, LifetimeAnnotation_ReturnFunctionPtr) {
               IsOkAndHolds(LifetimesAre({{"f", "a -> ((b -> b), static)"}})));
 }
 
+TEST_F(LifetimeAnnotationsTest, CachesAnnotations) {
+  bool success = runOnCodeWithLifetimeHandlers(
+      WithLifetimeMacros(R"(
+        int* $a f(int* $a, int* $b);
+      )"),
+      [](clang::ASTContext &ast_context,
+         const LifetimeAnnotationContext &lifetime_context) {
+        using clang::ast_matchers::functionDecl;
+        using clang::ast_matchers::hasName;
+        using clang::ast_matchers::match;
+
+        const auto *func = match(functionDecl(hasName("f")).bind("func"),
+                                 ast_context)[0]
+                               .getNodeAs<clang::FunctionDecl>("func");
+        const LifetimeAnnotationCache &cache =
+            *lifetime_context.annotation_cache;
+
+        LifetimeSymbolTable first_symbol_table;
+        llvm::Expected<FunctionLifetimes> first =
+            GetLifetimeAnnotations(func, lifetime_context, &first_symbol_table);
+        ASSERT_TRUE(bool(first));
+        EXPECT_EQ(cache.hits(), 0);
+        EXPECT_EQ(cache.misses(), 1);
+
+        LifetimeSymbolTable second_symbol_table;
+        llvm::Expected<FunctionLifetimes> second = GetLifetimeAnnotations(
+            func, lifetime_context, &second_symbol_table);
+        ASSERT_TRUE(bool(second));
+        EXPECT_EQ(cache.hits(), 1);
+        EXPECT_EQ(cache.misses(), 1);
+        EXPECT_EQ(NameLifetimes(*second, second_symbol_table), "a, b -> a");
+        EXPECT_EQ(NameLifetimes(*first, first_symbol_table),
+                  NameLifetimes(*second, second_symbol_table));
+
+        // A non-empty symbol table bypasses the cache.
+        llvm::Expected<FunctionLifetimes> third =
+            GetLifetimeAnnotations(func, lifetime_context, &first_symbol_table);
+        ASSERT_TRUE(bool(third));
+        EXPECT_EQ(cache.hits(), 1);
+        EXPECT_EQ(cache.misses(), 1);
+      });
+  EXPECT_TRUE(success);
+}
+
 } // namespace
 } // namespace lifetimes
 } // namespace tidy
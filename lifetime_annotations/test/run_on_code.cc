@@ -8,6 +8,7 @@
 #include <string>
 
 #include "lifetime_annotations/lifetime_annotations.h"
+#include "clang/Sema/SemaConsumer.h"
 
 namespace clang {
 namespace tidy {
@@ -15,29 +16,34 @@ namespace lifetimes {
 
 namespace {
 
-class RunOnCodeASTConsumer : public clang::ASTConsumer {
+class RunOnCodeASTConsumer : public clang::SemaConsumer {
  public:
   explicit RunOnCodeASTConsumer(
-      const std::function<void(clang::ASTContext&,
-                               const LifetimeAnnotationContext&)>& operation,
+      const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+          operation,
       std::shared_ptr<LifetimeAnnotationContext> lifetime_context)
       : operation_(operation), lifetime_context_(lifetime_context) {}
 
-  void HandleTranslationUnit(clang::ASTContext& ast_context) override {
-    operation_(ast_context, *lifetime_context_);
+  void InitializeSema(clang::Sema& sema) override { sema_ = &sema; }
+
+  void ForgetSema() override { sema_ = nullptr; }
+
+  void HandleTranslationUnit(clang::ASTContext&) override {
+    operation_(*sema_, *lifetime_context_);
   }
 
  private:
-  const std::function<void(clang::ASTContext&,
-                           const LifetimeAnnotationContext&)>& operation_;
+  const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+      operation_;
   std::shared_ptr<LifetimeAnnotationContext> lifetime_context_;
+  clang::Sema* sema_ = nullptr;
 };
 
 class RunOnCodeAction : public clang::ASTFrontendAction {
  public:
   explicit RunOnCodeAction(
-      const std::function<void(clang::ASTContext&,
-                               const LifetimeAnnotationContext&)>& operation,
+      const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+          operation,
       std::shared_ptr<LifetimeAnnotationContext> lifetime_context)
       : operation_(operation), lifetime_context_(lifetime_context) {}
 
@@ -50,8 +56,8 @@ class RunOnCodeAction : public clang::ASTFrontendAction {
   }
 
  private:
-  const std::function<void(clang::ASTContext&,
-                           const LifetimeAnnotationContext&)>& operation_;
+  const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+      operation_;
   std::shared_ptr<LifetimeAnnotationContext> lifetime_context_;
 };
 
@@ -63,6 +69,21 @@ bool runOnCodeWithLifetimeHandlers(
                              const LifetimeAnnotationContext&)>& operation,
     llvm::ArrayRef<std::string> args,
     const clang::tooling::FileContentMappings& file_contents) {
+  return runOnCodeWithLifetimeHandlers(
+      code,
+      [&operation](clang::Sema& sema,
+                   const LifetimeAnnotationContext& lifetime_context) {
+        operation(sema.getASTContext(), lifetime_context);
+      },
+      args, file_contents);
+}
+
+bool runOnCodeWithLifetimeHandlers(
+    llvm::StringRef code,
+    const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+        operation,
+    llvm::ArrayRef<std::string> args,
+    const clang::tooling::FileContentMappings& file_contents) {
   auto context = std::make_shared<LifetimeAnnotationContext>();
   return clang::tooling::runToolOnCodeWithArgs(
       std::make_unique<RunOnCodeAction>(operation, context), code, args,
@@ -10,6 +10,7 @@
 
 #include "lifetime_annotations/lifetime_annotations.h"
 #include "clang/AST/ASTContext.h"
+#include "clang/Sema/Sema.h"
 #include "clang/Tooling/Tooling.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
@@ -26,6 +27,16 @@ bool runOnCodeWithLifetimeHandlers(
     const clang::tooling::FileContentMappings& file_contents =
         clang::tooling::FileContentMappings());
 
+// Like the above, but gives `operation` access to the `Sema` that built the
+// AST, which is still alive while `operation` runs.
+bool runOnCodeWithLifetimeHandlers(
+    llvm::StringRef code,
+    const std::function<void(clang::Sema&, const LifetimeAnnotationContext&)>&
+        operation,
+    llvm::ArrayRef<std::string> args,
+    const clang::tooling::FileContentMappings& file_contents =
+        clang::tooling::FileContentMappings());
+
 }  // namespace lifetimes
 }  // namespace tidy
 }  // namespace clang
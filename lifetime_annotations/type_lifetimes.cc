@@ -173,14 +173,10 @@ ValueLifetimes& ValueLifetimes::operator=(const ValueLifetimes& other) {
   type_ = other.type_;
   template_argument_lifetimes_ = other.template_argument_lifetimes_;
   lifetime_parameters_by_name_ = other.lifetime_parameters_by_name_;
-  auto pointee_lifetimes =
-      other.pointee_lifetimes_
-          ? std::make_unique<ObjectLifetimes>(*other.pointee_lifetimes_)
-          : nullptr;
-  auto function_lifetimes =
-      other.function_lifetimes_
-          ? std::make_unique<FunctionLifetimes>(*other.function_lifetimes_)
-          : nullptr;
+  std::shared_ptr<const ObjectLifetimes> pointee_lifetimes =
+      other.pointee_lifetimes_;
+  std::shared_ptr<const FunctionLifetimes> function_lifetimes =
+      other.function_lifetimes_;
   // Note: because ValueLifetimes is a recursive type (pointee_lifetimes_
   // contains a ValueLifetimes), the following line can destroy `other`.
   // (Thus the temporary local variables before we perform the assignment.)
@@ -194,6 +190,43 @@ ValueLifetimes::~ValueLifetimes() = default;
 
 namespace {
 
+// Returns a mutable reference to the subtree held by `subtree`, first replacing
+// it with a copy if it is shared with other ValueLifetimes.
+// All subtrees are allocated as non-const objects (see the `std::make_shared`
+// calls below), so casting away the constness is safe.
+template <typename T>
+T& Unshare(std::shared_ptr<const T>& subtree) {
+  if (subtree.use_count() != 1) {
+    subtree = std::make_shared<T>(*subtree);
+  }
+  return const_cast<T&>(*subtree);
+}
+
+// Calls `traverse(subtree, visitor)`, where `visitor` may mutate lifetimes. If
+// the subtree is shared, it is traversed on a copy, which replaces it only if
+// `visitor` changes a lifetime, so that the subtree stays shared otherwise.
+// Read-only traversals should use the const overloads of `Traverse()`, which
+// never copy.
+template <typename T, typename TraverseFn>
+void TraverseSubtree(std::shared_ptr<const T>& subtree,
+                     const std::function<void(Lifetime&, Variance)>& visitor,
+                     TraverseFn traverse) {
+  if (subtree.use_count() == 1) {
+    traverse(const_cast<T&>(*subtree), visitor);
+    return;
+  }
+  T copy = *subtree;
+  bool changed = false;
+  traverse(copy, [&visitor, &changed](Lifetime& lifetime, Variance variance) {
+    Lifetime old_lifetime = lifetime;
+    visitor(lifetime, variance);
+    changed |= lifetime != old_lifetime;
+  });
+  if (changed) {
+    subtree = std::make_shared<T>(std::move(copy));
+  }
+}
+
 llvm::Error ForEachTemplateArgument(
     clang::QualType type, clang::TypeLoc type_loc,
     const std::function<llvm::Error(int, clang::QualType, clang::TypeLoc)>&
@@ -279,7 +312,7 @@ ValueLifetimes ValueLifetimes::PointerTo(const clang::QualType pointer_type,
   ret.type_ = pointer_type;
   assert(pointer_type->getPointeeType().getCanonicalType() ==
          obj.Type().getCanonicalType());
-  ret.pointee_lifetimes_ = std::make_unique<ObjectLifetimes>(obj);
+  ret.pointee_lifetimes_ = std::make_shared<ObjectLifetimes>(obj);
   return ret;
 }
 
@@ -316,7 +349,7 @@ llvm::Expected<ValueLifetimes> ValueLifetimes::Create(
       return std::move(err);
     }
     ret.function_lifetimes_ =
-        std::make_unique<FunctionLifetimes>(std::move(fn_lftm));
+        std::make_shared<FunctionLifetimes>(std::move(fn_lftm));
     return ret;
   }
 
@@ -402,7 +435,7 @@ llvm::Expected<ValueLifetimes> ValueLifetimes::Create(
     return std::move(err);
   }
   ret.pointee_lifetimes_ =
-      std::make_unique<ObjectLifetimes>(object_lifetime, value_lifetimes);
+      std::make_shared<ObjectLifetimes>(object_lifetime, value_lifetimes);
   return ret;
 }
 
@@ -416,7 +449,7 @@ ValueLifetimes ValueLifetimes::ForPointerLikeType(
   assert(!PointeeType(type).isNull());
   ValueLifetimes result(type);
   result.pointee_lifetimes_ =
-      std::make_unique<ObjectLifetimes>(object_lifetimes);
+      std::make_shared<ObjectLifetimes>(object_lifetimes);
   return result;
 }
 
@@ -540,6 +573,10 @@ bool ValueLifetimes::HasAny(
 }
 
 void ValueLifetimes::SubstituteLifetimes(const LifetimeSubstitutions& subst) {
+  // Subtrees that `subst` leaves unchanged stay shared.
+  auto is_substituted = [&subst](Lifetime lifetime) {
+    return subst.Substitute(lifetime) != lifetime;
+  };
   for (auto& tmpl_arg_at_depth : template_argument_lifetimes_) {
     for (std::optional<ValueLifetimes>& tmpl_arg : tmpl_arg_at_depth) {
       if (tmpl_arg) {
@@ -547,8 +584,8 @@ void ValueLifetimes::SubstituteLifetimes(const LifetimeSubstitutions& subst) {
       }
     }
   }
-  if (pointee_lifetimes_) {
-    pointee_lifetimes_->SubstituteLifetimes(subst);
+  if (pointee_lifetimes_ && pointee_lifetimes_->HasAny(is_substituted)) {
+    Unshare(pointee_lifetimes_).SubstituteLifetimes(subst);
   }
   for (const auto& lftm_arg : GetLifetimeParameters(type_)) {
     std::optional<Lifetime> lifetime =
@@ -556,8 +593,8 @@ void ValueLifetimes::SubstituteLifetimes(const LifetimeSubstitutions& subst) {
     assert(lifetime.has_value());
     lifetime_parameters_by_name_.Rebind(lftm_arg, subst.Substitute(*lifetime));
   }
-  if (function_lifetimes_) {
-    function_lifetimes_->SubstituteLifetimes(subst);
+  if (function_lifetimes_ && function_lifetimes_->HasAny(is_substituted)) {
+    Unshare(function_lifetimes_).SubstituteLifetimes(subst);
   }
 }
 
@@ -571,7 +608,13 @@ void ValueLifetimes::Traverse(std::function<void(Lifetime&, Variance)> visitor,
     }
   }
   if (pointee_lifetimes_) {
-    pointee_lifetimes_->Traverse(visitor, variance, Type());
+    TraverseSubtree(
+        pointee_lifetimes_, visitor,
+        [variance, this](
+            ObjectLifetimes& pointee,
+            std::function<void(Lifetime&, Variance)> subtree_visitor) {
+          pointee.Traverse(std::move(subtree_visitor), variance, Type());
+        });
   }
   for (const auto& lftm_arg : GetLifetimeParameters(type_)) {
     std::optional<Lifetime> lifetime =
@@ -580,25 +623,44 @@ void ValueLifetimes::Traverse(std::function<void(Lifetime&, Variance)> visitor,
     Lifetime new_lifetime = *lifetime;
     visitor(new_lifetime, variance);
 
-    // Note that this check is not an optimization, but a guard against UB:
-    // if one calls the const version of Traverse, with a callback that does not
-    // mutate the lifetime, on a const instance of the Value/ObjectLifetimes,
-    // then calling Rebind would be UB, even if Rebind would do nothing in
-    // practice.
     if (new_lifetime != lifetime) {
       lifetime_parameters_by_name_.Rebind(lftm_arg, new_lifetime);
     }
   }
   if (function_lifetimes_) {
-    function_lifetimes_->Traverse(visitor);
+    TraverseSubtree(
+        function_lifetimes_, visitor,
+        [](FunctionLifetimes& function,
+           std::function<void(Lifetime&, Variance)> subtree_visitor) {
+          function.Traverse(std::move(subtree_visitor));
+        });
   }
 }
 
 void ValueLifetimes::Traverse(
     std::function<void(const Lifetime&, Variance)> visitor,
     Variance variance) const {
-  const_cast<ValueLifetimes*>(this)->Traverse(
-      [&visitor](Lifetime& l, Variance v) { visitor(l, v); }, variance);
+  // This visits the lifetimes in the same order and with the same variance as
+  // the mutating overload, but never copies shared subtrees.
+  for (const auto& tmpl_arg_at_depth : template_argument_lifetimes_) {
+    for (const std::optional<ValueLifetimes>& tmpl_arg : tmpl_arg_at_depth) {
+      if (tmpl_arg) {
+        tmpl_arg->Traverse(visitor, kInvariant);
+      }
+    }
+  }
+  if (pointee_lifetimes_) {
+    pointee_lifetimes_->Traverse(visitor, variance, Type());
+  }
+  for (const auto& lftm_arg : GetLifetimeParameters(type_)) {
+    std::optional<Lifetime> lifetime =
+        lifetime_parameters_by_name_.LookupName(lftm_arg);
+    assert(lifetime.has_value());
+    visitor(*lifetime, variance);
+  }
+  if (function_lifetimes_) {
+    function_lifetimes_->Traverse(visitor);
+  }
 }
 
 ValueLifetimes::ValueLifetimes(clang::QualType type) : type_(type) {}
@@ -883,9 +945,14 @@ void ObjectLifetimes::Traverse(std::function<void(Lifetime&, Variance)> visitor,
 void ObjectLifetimes::Traverse(
     std::function<void(const Lifetime&, Variance)> visitor, Variance variance,
     clang::QualType indirection_type) const {
-  const_cast<ObjectLifetimes*>(this)->Traverse(
-      [&visitor](Lifetime& l, Variance v) { visitor(l, v); }, variance,
-      indirection_type);
+  assert(indirection_type.isNull() ||
+         StripAttributes(indirection_type->getPointeeType().IgnoreParens()) ==
+             Type());
+  value_lifetimes_.Traverse(
+      visitor, indirection_type.isNull() || indirection_type.isConstQualified()
+                   ? kCovariant
+                   : kInvariant);
+  visitor(lifetime_, variance);
 }
 
 llvm::Expected<llvm::StringRef> EvaluateAsStringLiteral(
@@ -932,7 +999,8 @@ bool DenseMapInfo<clang::tidy::lifetimes::ValueLifetimes>::isEqual(
       (rhs.pointee_lifetimes_ == nullptr)) {
     return false;
   }
-  if (lhs.pointee_lifetimes_ &&
+  // Shared subtrees are equal without looking into them.
+  if (lhs.pointee_lifetimes_ != rhs.pointee_lifetimes_ &&
       !DenseMapInfo<clang::tidy::lifetimes::ObjectLifetimes>::isEqual(
           *lhs.pointee_lifetimes_, *rhs.pointee_lifetimes_)) {
     return false;
@@ -202,8 +202,12 @@ class ValueLifetimes {
 
   // Note: only one of `pointee_lifetimes_`, `function_lifetimes_` or
   // `template_argument_lifetimes_` is non-empty.
-  std::unique_ptr<ObjectLifetimes> pointee_lifetimes_;
-  std::unique_ptr<FunctionLifetimes> function_lifetimes_;
+  // The pointee and function subtrees are shared between copies of a
+  // ValueLifetimes, so that copying is cheap. A shared subtree is never
+  // modified in place: `SubstituteLifetimes()` and `Traverse()` replace it with
+  // a modified copy, and only if they actually change one of its lifetimes.
+  std::shared_ptr<const ObjectLifetimes> pointee_lifetimes_;
+  std::shared_ptr<const FunctionLifetimes> function_lifetimes_;
   std::vector<std::vector<std::optional<ValueLifetimes>>>
       template_argument_lifetimes_;
   clang::QualType type_;
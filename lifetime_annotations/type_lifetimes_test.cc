@@ -0,0 +1,128 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "lifetime_annotations/type_lifetimes.h"
+
+#include <functional>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "lifetime_annotations/lifetime.h"
+#include "lifetime_annotations/lifetime_annotations.h"
+#include "lifetime_annotations/lifetime_substitutions.h"
+#include "lifetime_annotations/test/run_on_code.h"
+#include "clang/AST/ASTContext.h"
+#include "llvm/Support/Error.h"
+
+namespace clang {
+namespace tidy {
+namespace lifetimes {
+namespace {
+
+// Returns lifetimes for a value of type `int**`, with fresh variable lifetimes.
+ValueLifetimes PointerToPointerLifetimes(clang::ASTContext& ast_context) {
+  clang::QualType type =
+      ast_context.getPointerType(ast_context.getPointerType(ast_context.IntTy));
+  return llvm::cantFail(ValueLifetimes::Create(
+      type, clang::TypeLoc(),
+      [](const clang::Expr*) { return Lifetime::CreateVariable(); }));
+}
+
+// Runs `test` with an (empty) `ASTContext`.
+void RunWithASTContext(const std::function<void(clang::ASTContext&)>& test) {
+  EXPECT_TRUE(runOnCodeWithLifetimeHandlers(
+      "",
+      [&test](clang::ASTContext& ast_context,
+              const LifetimeAnnotationContext&) { test(ast_context); },
+      {}));
+}
+
+TEST(TypeLifetimesTest, CopiesShareSubtrees) {
+  RunWithASTContext([](clang::ASTContext& ast_context) {
+    ValueLifetimes original = PointerToPointerLifetimes(ast_context);
+    ValueLifetimes copy = original;
+    EXPECT_EQ(&copy.GetPointeeLifetimes(), &original.GetPointeeLifetimes());
+  });
+}
+
+TEST(TypeLifetimesTest, ReadOnlyTraversalKeepsSubtreesShared) {
+  RunWithASTContext([](clang::ASTContext& ast_context) {
+    ValueLifetimes original = PointerToPointerLifetimes(ast_context);
+    ValueLifetimes copy = original;
+
+    int num_lifetimes = 0;
+    std::as_const(copy).Traverse(
+        [&num_lifetimes](const Lifetime&, Variance) { ++num_lifetimes; });
+    EXPECT_EQ(num_lifetimes, 2);
+    EXPECT_EQ(&copy.GetPointeeLifetimes(), &original.GetPointeeLifetimes());
+
+    // A mutating traversal that does not change any lifetime doesn't unshare
+    // anything either.
+    copy.Traverse([](Lifetime&, Variance) {});
+    EXPECT_EQ(&copy.GetPointeeLifetimes(), &original.GetPointeeLifetimes());
+  });
+}
+
+TEST(TypeLifetimesTest, SubstitutionUnsharesOnlyChangedPath) {
+  RunWithASTContext([](clang::ASTContext& ast_context) {
+    ValueLifetimes original = PointerToPointerLifetimes(ast_context);
+    const ObjectLifetimes& outer = original.GetPointeeLifetimes();
+    const ObjectLifetimes& inner =
+        outer.GetValueLifetimes().GetPointeeLifetimes();
+    Lifetime outer_lifetime = outer.GetLifetime();
+    Lifetime inner_lifetime = inner.GetLifetime();
+
+    ValueLifetimes copy = original;
+    Lifetime replacement = Lifetime::CreateVariable();
+    LifetimeSubstitutions subst;
+    subst.Add(outer_lifetime, replacement);
+    copy.SubstituteLifetimes(subst);
+
+    const ObjectLifetimes& copy_outer = copy.GetPointeeLifetimes();
+    EXPECT_NE(&copy_outer, &outer);
+    EXPECT_EQ(copy_outer.GetLifetime(), replacement);
+    EXPECT_EQ(&copy_outer.GetValueLifetimes().GetPointeeLifetimes(), &inner);
+
+    EXPECT_EQ(original.GetPointeeLifetimes().GetLifetime(), outer_lifetime);
+    EXPECT_EQ(inner.GetLifetime(), inner_lifetime);
+  });
+}
+
+TEST(TypeLifetimesTest, MutatingTraversalUnsharesOnlyChangedPath) {
+  RunWithASTContext([](clang::ASTContext& ast_context) {
+    ValueLifetimes original = PointerToPointerLifetimes(ast_context);
+    const ObjectLifetimes& outer = original.GetPointeeLifetimes();
+    const ObjectLifetimes& inner =
+        outer.GetValueLifetimes().GetPointeeLifetimes();
+    Lifetime outer_lifetime = outer.GetLifetime();
+    Lifetime inner_lifetime = inner.GetLifetime();
+
+    ValueLifetimes copy = original;
+    Lifetime replacement = Lifetime::CreateVariable();
+    copy.Traverse([inner_lifetime, replacement](Lifetime& lifetime, Variance) {
+      if (lifetime == inner_lifetime) {
+        lifetime = replacement;
+      }
+    });
+
+    // The changed lifetime is in the innermost subtree, so every subtree on the
+    // path to it has been replaced.
+    const ObjectLifetimes& copy_outer = copy.GetPointeeLifetimes();
+    const ObjectLifetimes& copy_inner =
+        copy_outer.GetValueLifetimes().GetPointeeLifetimes();
+    EXPECT_NE(&copy_outer, &outer);
+    EXPECT_NE(&copy_inner, &inner);
+    EXPECT_EQ(copy_outer.GetLifetime(), outer_lifetime);
+    EXPECT_EQ(copy_inner.GetLifetime(), replacement);
+
+    EXPECT_EQ(outer.GetLifetime(), outer_lifetime);
+    EXPECT_EQ(inner.GetLifetime(), inner_lifetime);
+  });
+}
+
+}  // namespace
+}  // namespace lifetimes
+}  // namespace tidy
+}  // namespace clang
@@ -8,6 +8,8 @@ Disclaimer: This project is experimental, under heavy development, and should
 not be used yet.
 """
 
+load("@bazel_skylib//rules:common_settings.bzl", "BuildSettingInfo")
+
 def compile_cc(
         ctx,
         attr,
@@ -32,6 +34,14 @@ def compile_cc(
     """
     cc_info = cc_common.merge_cc_infos(cc_infos = cc_infos)
 
+    user_compile_flags = attr.copts if hasattr(attr, "copts") else []
+    if ctx.attr._cross_language_inlining[BuildSettingInfo].value:
+        # Emit LLVM bitcode instead of machine code, so that a linker-plugin LTO
+        # link (Rust code compiled with `-Clinker-plugin-lto`) can inline the
+        # thunks (and the C++ inline functions they call) into their Rust
+        # callers.
+        user_compile_flags = user_compile_flags + ["-flto=thin"]
+
     (compilation_context, compilation_outputs) = cc_common.compile(
         name = src.basename,
         actions = ctx.actions,
@@ -40,7 +50,7 @@ def compile_cc(
         srcs = [src],
         additional_inputs = extra_cc_compilation_action_inputs,
         grep_includes = ctx.file._grep_includes,
-        user_compile_flags = attr.copts if hasattr(attr, "copts") else [],
+        user_compile_flags = user_compile_flags,
         compilation_contexts = [cc_info.compilation_context],
     )
 
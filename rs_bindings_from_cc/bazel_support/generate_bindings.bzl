@@ -75,6 +75,8 @@ def generate_bindings(
             "--error_report_out",
             error_report_output.path,
         ]
+    if ctx.attr._compact_layout_assertions[BuildSettingInfo].value:
+        rs_bindings_from_cc_flags += ["--compact_layout_assertions"]
 
     variables = cc_common.create_compile_variables(
         feature_configuration = feature_configuration,
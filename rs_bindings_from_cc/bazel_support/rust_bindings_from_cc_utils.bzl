@@ -170,4 +170,10 @@ bindings_attrs = {
     "_generate_error_report": attr.label(
         default = "//rs_bindings_from_cc/bazel_support:generate_error_report",
     ),
+    "_cross_language_inlining": attr.label(
+        default = "//rs_bindings_from_cc/bazel_support:cross_language_inlining",
+    ),
+    "_compact_layout_assertions": attr.label(
+        default = "//rs_bindings_from_cc/bazel_support:compact_layout_assertions",
+    ),
 }
@@ -5,8 +5,6 @@
 #ifndef CRUBIT_RS_BINDINGS_FROM_CC_BAZEL_TYPES_H_
 #define CRUBIT_RS_BINDINGS_FROM_CC_BAZEL_TYPES_H_
 
-#include <string>
-
 #include "common/string_type.h"
 
 namespace crubit {
@@ -14,10 +12,6 @@ namespace crubit {
 // Representation of a Bazel label (for example //foo/bar:baz).
 CRUBIT_DEFINE_STRING_TYPE(BazelLabel);
 
-// Coverts the argument to a valid C++ identifier (e.g. replacing characters
-// like ":" or "/" with "_").
-std::string ConvertToCcIdentifier(const BazelLabel&);
-
 }  // namespace crubit
 
 #endif  // CRUBIT_RS_BINDINGS_FROM_CC_BAZEL_TYPES_H_
@@ -13,6 +13,8 @@
 #include "absl/flags/flag.h"
 #include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
 #include "absl/strings/substitute.h"
 #include "common/status_macros.h"
 #include "llvm/Support/JSON.h"
@@ -65,11 +67,34 @@ ABSL_FLAG(std::string, instantiations_out, "",
           "[template instantiation mode only] output path for the JSON file "
           "with mapping from a template instantiation to a generated Rust "
           "struct name. This file is used by cc_template! macro expansion.");
+ABSL_FLAG(std::string, instantiations_cache_dir, "",
+          "[template instantiation mode only] (optional) directory of a store "
+          "of the outputs of earlier runs. A run that requests exactly the "
+          "same set of instantiations as an earlier one (with the same "
+          "toolchain and headers) reuses its outputs; sets that merely "
+          "overlap share nothing. The store is not part of the build graph, "
+          "so this flag must not be used in Bazel actions.");
 ABSL_FLAG(std::string, namespaces_out, "",
           "(optional) output path for the JSON file containing the target's"
           "namespace hierarchy.");
 ABSL_FLAG(std::string, error_report_out, "",
           "(optional) output path for the JSON error report");
+ABSL_FLAG(bool, shard_rs_out, false,
+          "(optional) if set to true the bindings for each top-level namespace "
+          "are written to a separate file in the `<rs_out stem>_shards` "
+          "directory next to --rs_out, so that rustc can compile and cache "
+          "them independently. The file written to --rs_out refers to the "
+          "shards via `#[path]` attributes.");
+ABSL_FLAG(std::string, profile_out, "",
+          "(optional) output path for a JSON file (in the Chrome trace event "
+          "format) with the time spent in the phases of bindings generation, "
+          "the peak RSS of the process and the number of IR items.");
+ABSL_FLAG(bool, compact_layout_assertions, false,
+          "(optional) if set to true the size, alignment and field offset "
+          "assertions of all the records are aggregated into a single "
+          "table-driven check in the generated Rust bindings and a single "
+          "`static_assert` in the generated C++ thunks, which is cheaper to "
+          "compile than one assertion per property.");
 
 namespace crubit {
 
@@ -102,7 +127,10 @@ absl::StatusOr<Cmdline> Cmdline::Create() {
       absl::GetFlag(FLAGS_extra_rs_srcs),
       absl::GetFlag(FLAGS_srcs_to_scan_for_instantiations),
       absl::GetFlag(FLAGS_instantiations_out),
-      absl::GetFlag(FLAGS_error_report_out));
+      absl::GetFlag(FLAGS_error_report_out), absl::GetFlag(FLAGS_shard_rs_out),
+      absl::GetFlag(FLAGS_profile_out),
+      absl::GetFlag(FLAGS_compact_layout_assertions),
+      absl::GetFlag(FLAGS_instantiations_cache_dir));
 }
 
 absl::StatusOr<Cmdline> Cmdline::CreateFromArgs(
@@ -113,7 +141,9 @@ absl::StatusOr<Cmdline> Cmdline::CreateFromArgs(
     bool do_nothing, std::vector<std::string> public_headers,
     std::string targets_and_headers_str, std::vector<std::string> extra_rs_srcs,
     std::vector<std::string> srcs_to_scan_for_instantiations,
-    std::string instantiations_out, std::string error_report_out) {
+    std::string instantiations_out, std::string error_report_out,
+    bool shard_rs_out, std::string profile_out,
+    bool compact_layout_assertions, std::string instantiations_cache_dir) {
   Cmdline cmdline;
   if (current_target.empty()) {
     return absl::InvalidArgumentError("please specify --target");
@@ -123,6 +153,11 @@ absl::StatusOr<Cmdline> Cmdline::CreateFromArgs(
   if (rs_out.empty()) {
     return absl::InvalidArgumentError("please specify --rs_out");
   }
+  if (shard_rs_out) {
+    absl::string_view rs_out_stem = rs_out;
+    absl::ConsumeSuffix(&rs_out_stem, ".rs");
+    cmdline.rs_out_shards_dir_ = absl::StrCat(rs_out_stem, "_shards");
+  }
   cmdline.rs_out_ = std::move(rs_out);
 
   if (cc_out.empty()) {
@@ -169,7 +204,24 @@ absl::StatusOr<Cmdline> Cmdline::CreateFromArgs(
   cmdline.instantiations_out_ = std::move(instantiations_out);
   cmdline.srcs_to_scan_for_instantiations_ =
       std::move(srcs_to_scan_for_instantiations);
+  if (!instantiations_cache_dir.empty()) {
+    if (cmdline.instantiations_out_.empty()) {
+      return absl::InvalidArgumentError(
+          "--instantiations_cache_dir can only be used in the template "
+          "instantiation mode");
+    }
+    // Only the outputs of the template instantiation mode are stored.
+    if (!cmdline.ir_out_.empty() || !cmdline.namespaces_out_.empty() ||
+        !error_report_out.empty() || shard_rs_out) {
+      return absl::InvalidArgumentError(
+          "--instantiations_cache_dir can't be combined with --ir_out, "
+          "--namespaces_out, --error_report_out or --shard_rs_out");
+    }
+  }
+  cmdline.instantiations_cache_dir_ = std::move(instantiations_cache_dir);
   cmdline.error_report_out_ = std::move(error_report_out);
+  cmdline.profile_out_ = std::move(profile_out);
+  cmdline.compact_layout_assertions_ = compact_layout_assertions;
 
   if (targets_and_headers_str.empty()) {
     return absl::InvalidArgumentError("please specify --targets_and_headers");
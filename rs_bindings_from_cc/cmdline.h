@@ -33,7 +33,9 @@ class Cmdline {
       std::string targets_and_headers_str,
       std::vector<std::string> extra_rs_sources,
       std::vector<std::string> srcs_to_scan_for_instantiations,
-      std::string instantiations_out, std::string error_report_out) {
+      std::string instantiations_out, std::string error_report_out,
+      bool shard_rs_out, std::string profile_out,
+      bool compact_layout_assertions, std::string instantiations_cache_dir) {
     return CreateFromArgs(
         std::move(current_target), std::move(cc_out), std::move(rs_out),
         std::move(ir_out), std::move(namespaces_out),
@@ -41,7 +43,9 @@ class Cmdline {
         std::move(rustfmt_exe_path), std::move(rustfmt_config_path), do_nothing,
         std::move(public_headers), std::move(targets_and_headers_str),
         std::move(extra_rs_sources), std::move(srcs_to_scan_for_instantiations),
-        std::move(instantiations_out), std::move(error_report_out));
+        std::move(instantiations_out), std::move(error_report_out),
+        shard_rs_out, std::move(profile_out), compact_layout_assertions,
+        std::move(instantiations_cache_dir));
   }
 
   Cmdline(const Cmdline&) = delete;
@@ -61,6 +65,18 @@ class Cmdline {
   absl::string_view rustfmt_config_path() const { return rustfmt_config_path_; }
   absl::string_view instantiations_out() const { return instantiations_out_; }
   absl::string_view error_report_out() const { return error_report_out_; }
+  // Directory of the store of template instantiation bindings shared by all
+  // the crates, or an empty string if the bindings should always be generated
+  // from scratch.
+  absl::string_view instantiations_cache_dir() const {
+    return instantiations_cache_dir_;
+  }
+  // Directory (next to `rs_out`) that the bindings for top-level namespaces
+  // should be written to, or an empty string if `rs_out` should not be split
+  // into shards.
+  absl::string_view rs_out_shards_dir() const { return rs_out_shards_dir_; }
+  absl::string_view profile_out() const { return profile_out_; }
+  bool compact_layout_assertions() const { return compact_layout_assertions_; }
   bool do_nothing() const { return do_nothing_; }
 
   const std::vector<HeaderName>& public_headers() const {
@@ -94,18 +110,23 @@ class Cmdline {
       std::string targets_and_headers_str,
       std::vector<std::string> extra_rs_sources,
       std::vector<std::string> srcs_to_scan_for_instantiations,
-      std::string instantiations_out, std::string error_report_out);
+      std::string instantiations_out, std::string error_report_out,
+      bool shard_rs_out, std::string profile_out,
+      bool compact_layout_assertions, std::string instantiations_cache_dir);
 
   absl::StatusOr<BazelLabel> FindHeader(const HeaderName& header) const;
 
   std::string cc_out_;
   std::string rs_out_;
+  std::string rs_out_shards_dir_;
   std::string ir_out_;
   std::string crubit_support_path_;
   std::string clang_format_exe_path_;
   std::string rustfmt_exe_path_;
   std::string rustfmt_config_path_;
   std::string error_report_out_;
+  std::string profile_out_;
+  bool compact_layout_assertions_ = false;
   bool do_nothing_ = true;
 
   BazelLabel current_target_;
@@ -116,6 +137,7 @@ class Cmdline {
 
   std::vector<std::string> srcs_to_scan_for_instantiations_;
   std::string instantiations_out_;
+  std::string instantiations_cache_dir_;
 
   std::string namespaces_out_;
 };
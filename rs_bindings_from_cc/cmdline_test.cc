@@ -36,7 +36,10 @@ absl::StatusOr<Cmdline> TestCmdline(std::string target,
       /* extra_rs_srcs= */ {},
       /* srcs_to_scan_for_instantiations= */ {},
       /* instantiations_out= */ "",
-      /* error_report_out= */ "");
+      /* error_report_out= */ "",
+      /* shard_rs_out= */ false, /* profile_out= */ "",
+      /* compact_layout_assertions= */ false,
+      /* instantiations_cache_dir= */ "");
 }
 
 absl::StatusOr<Cmdline> TestCmdline(std::vector<std::string> public_headers,
@@ -57,7 +60,10 @@ TEST(CmdlineTest, BasicCorrectInput) {
           /* do_nothing= */ false, {"h1"},
           R"([{"t": "//:t1", "h": ["h1", "h2"]}])", {"extra_file.rs"},
           {"scan_for_instantiations.rs"}, "instantiations_out",
-          "error_report_out"));
+          "error_report_out",
+          /* shard_rs_out= */ false, "profile_out",
+          /* compact_layout_assertions= */ true,
+          /* instantiations_cache_dir= */ ""));
   EXPECT_EQ(cmdline.cc_out(), "cc_out");
   EXPECT_EQ(cmdline.rs_out(), "rs_out");
   EXPECT_EQ(cmdline.ir_out(), "ir_out");
@@ -68,6 +74,9 @@ TEST(CmdlineTest, BasicCorrectInput) {
   EXPECT_EQ(cmdline.rustfmt_config_path(), "rustfmt_config_path");
   EXPECT_EQ(cmdline.instantiations_out(), "instantiations_out");
   EXPECT_EQ(cmdline.error_report_out(), "error_report_out");
+  EXPECT_EQ(cmdline.rs_out_shards_dir(), "");
+  EXPECT_EQ(cmdline.profile_out(), "profile_out");
+  EXPECT_EQ(cmdline.compact_layout_assertions(), true);
   EXPECT_EQ(cmdline.do_nothing(), false);
   EXPECT_EQ(cmdline.current_target().value(), "//:t1");
   EXPECT_THAT(cmdline.public_headers(), ElementsAre(HeaderName("h1")));
@@ -234,7 +243,10 @@ TEST(CmdlineTest, InstantiationsOutEmpty) {
           "rustfmt_config_path",
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {}, {"lib.rs"},
-          /* instantiations_out= */ "", "error_report_out")),
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ "")),
       StatusIs(
           absl::StatusCode::kInvalidArgument,
           HasSubstr(
@@ -254,7 +266,10 @@ TEST(CmdlineTest, RustSourcesEmpty) {
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {}, "instantiations_out",
-          "error_report_out"),
+          "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""),
       StatusIs(
           absl::StatusCode::kInvalidArgument,
           HasSubstr(
@@ -262,6 +277,63 @@ TEST(CmdlineTest, RustSourcesEmpty) {
               "when requesting a template instantiation mode")));
 }
 
+TEST(CmdlineTest, InstantiationsCacheDir) {
+  constexpr absl::string_view kTargetsAndHeaders = R"([
+    {"t": "//:target1", "h": ["a.h", "b.h"]}
+  ])";
+  ASSERT_OK_AND_ASSIGN(
+      Cmdline cmdline,
+      Cmdline::CreateForTesting(
+          "//:target1", "cc_out", "rs_out", /* ir_out= */ "",
+          /* namespaces_out= */ "", "crubit_support_path",
+          "clang_format_exe_path", "rustfmt_exe_path", "rustfmt_config_path",
+          /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
+          /* extra_rs_srcs= */ {}, {"lib.rs"}, "instantiations_out",
+          /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false, "instantiations_cache"));
+  EXPECT_EQ(cmdline.instantiations_cache_dir(), "instantiations_cache");
+}
+
+TEST(CmdlineTest, InstantiationsCacheDirOutsideOfInstantiationMode) {
+  constexpr absl::string_view kTargetsAndHeaders = R"([
+    {"t": "//:target1", "h": ["a.h", "b.h"]}
+  ])";
+  ASSERT_THAT(
+      Cmdline::CreateForTesting(
+          "//:target1", "cc_out", "rs_out", /* ir_out= */ "",
+          /* namespaces_out= */ "", "crubit_support_path",
+          "clang_format_exe_path", "rustfmt_exe_path", "rustfmt_config_path",
+          /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
+          /* extra_rs_srcs= */ {},
+          /* srcs_to_scan_for_instantiations= */ {},
+          /* instantiations_out= */ "", /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false, "instantiations_cache"),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("--instantiations_cache_dir can only be used in the "
+                         "template instantiation mode")));
+}
+
+TEST(CmdlineTest, InstantiationsCacheDirWithIrOut) {
+  constexpr absl::string_view kTargetsAndHeaders = R"([
+    {"t": "//:target1", "h": ["a.h", "b.h"]}
+  ])";
+  ASSERT_THAT(
+      Cmdline::CreateForTesting(
+          "//:target1", "cc_out", "rs_out", "ir_out",
+          /* namespaces_out= */ "", "crubit_support_path",
+          "clang_format_exe_path", "rustfmt_exe_path", "rustfmt_config_path",
+          /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
+          /* extra_rs_srcs= */ {}, {"lib.rs"}, "instantiations_out",
+          /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false, "instantiations_cache"),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("--instantiations_cache_dir can't be combined with "
+                         "--ir_out")));
+}
+
 TEST(CmdlineTest, CcOutEmpty) {
   constexpr absl::string_view kTargetsAndHeaders = R"([
     {"t": "//:target1", "h": ["a.h", "b.h"]}
@@ -275,7 +347,10 @@ TEST(CmdlineTest, CcOutEmpty) {
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
-          /* instantiations_out= */ "", "error_report_out"),
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""),
       StatusIs(absl::StatusCode::kInvalidArgument,
                HasSubstr("please specify --cc_out")));
 }
@@ -292,7 +367,10 @@ TEST(CmdlineTest, RsOutEmpty) {
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
-          /* instantiations_out= */ "", "error_report_out"),
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""),
       StatusIs(absl::StatusCode::kInvalidArgument,
                HasSubstr("please specify --rs_out")));
 }
@@ -308,7 +386,32 @@ TEST(CmdlineTest, IrOutEmpty) {
       /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
       /* extra_rs_srcs= */ {},
       /* srcs_to_scan_for_instantiations= */ {},
-      /* instantiations_out= */ "", "error_report_out"));
+      /* instantiations_out= */ "", "error_report_out",
+      /* shard_rs_out= */ false, /* profile_out= */ "",
+      /* compact_layout_assertions= */ false,
+      /* instantiations_cache_dir= */ ""));
+}
+
+TEST(CmdlineTest, ShardRsOut) {
+  constexpr absl::string_view kTargetsAndHeaders = R"([
+    {"t": "//:target1", "h": ["a.h", "b.h"]}
+  ])";
+  ASSERT_OK_AND_ASSIGN(
+      Cmdline cmdline,
+      Cmdline::CreateForTesting(
+          "//:target1", "cc_out", "foo/bar_rust_api.rs", "ir_out",
+          "namespaces_out", "crubit_support_path", "clang_format_exe_path",
+          "rustfmt_exe_path", "rustfmt_config_path",
+          /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
+          /* extra_rs_srcs= */ {},
+          /* srcs_to_scan_for_instantiations= */ {},
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ true,
+          /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""));
+  EXPECT_EQ(cmdline.rs_out(), "foo/bar_rust_api.rs");
+  EXPECT_EQ(cmdline.rs_out_shards_dir(), "foo/bar_rust_api_shards");
 }
 
 TEST(CmdlineTest, ClangFormatExePathEmpty) {
@@ -324,7 +427,10 @@ TEST(CmdlineTest, ClangFormatExePathEmpty) {
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
-          /* instantiations_out= */ "", "error_report_out"),
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""),
       StatusIs(absl::StatusCode::kInvalidArgument,
                HasSubstr("please specify --clang_format_exe_path")));
 }
@@ -341,7 +447,10 @@ TEST(CmdlineTest, RustfmtExePathEmpty) {
           /* do_nothing= */ false, {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
-          /* instantiations_out= */ "", "error_report_out"),
+          /* instantiations_out= */ "", "error_report_out",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""),
       StatusIs(absl::StatusCode::kInvalidArgument,
                HasSubstr("please specify --rustfmt_exe_path")));
 }
@@ -14,9 +14,12 @@
 #include "common/status_macros.h"
 #include "rs_bindings_from_cc/collect_instantiations.h"
 #include "rs_bindings_from_cc/collect_namespaces.h"
+#include "rs_bindings_from_cc/instantiations_cache.h"
 #include "rs_bindings_from_cc/ir.h"
 #include "rs_bindings_from_cc/ir_from_cc.h"
 #include "rs_bindings_from_cc/src_code_gen.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/TimeProfiler.h"
 
 namespace crubit {
 
@@ -66,6 +69,35 @@ absl::StatusOr<BindingsAndMetadata> GenerateBindingsAndMetadata(
       std::vector<std::string> requested_instantiations,
       CollectInstantiations(cmdline.srcs_to_scan_for_instantiations()));
 
+  std::string cache_key;
+  if (!cmdline.instantiations_cache_dir().empty()) {
+    std::string tools_fingerprint =
+        ToolsFingerprint({GeneratorExecutablePath(),
+                          std::string(cmdline.clang_format_exe_path()),
+                          std::string(cmdline.rustfmt_exe_path()),
+                          std::string(cmdline.rustfmt_config_path())});
+    CRUBIT_ASSIGN_OR_RETURN(
+        std::string headers_fingerprint,
+        IncludedHeadersFingerprint(cmdline.public_headers(), clang_args,
+                                   virtual_headers_contents_for_testing));
+    cache_key =
+        InstantiationsCacheKey(cmdline, clang_args, requested_instantiations,
+                               tools_fingerprint, headers_fingerprint);
+    CRUBIT_ASSIGN_OR_RETURN(
+        std::optional<CachedInstantiations> cached,
+        LookUpInstantiationsCache(cmdline.instantiations_cache_dir(),
+                                  cache_key));
+    if (cached.has_value()) {
+      // The IR is not stored, which is why `Cmdline` doesn't allow combining
+      // the store with `--ir_out` (or other outputs derived from the IR).
+      return BindingsAndMetadata{
+          .rs_api = std::move(cached->rs_api),
+          .rs_api_impl = std::move(cached->rs_api_impl),
+          .instantiations = std::move(cached->instantiations),
+      };
+    }
+  }
+
   CRUBIT_ASSIGN_OR_RETURN(
       IR ir,
       IrFromCc(
@@ -79,13 +111,20 @@ absl::StatusOr<BindingsAndMetadata> GenerateBindingsAndMetadata(
   }
 
   bool generate_error_report = !cmdline.error_report_out().empty();
+  // `#[path]` attributes in the crate root are relative to the directory of
+  // the crate root, which is also where the shards directory lives.
+  std::string rs_api_shards_path =
+      llvm::sys::path::filename(cmdline.rs_out_shards_dir()).str();
   CRUBIT_ASSIGN_OR_RETURN(
       Bindings bindings,
       GenerateBindings(ir, cmdline.crubit_support_path(),
                        cmdline.clang_format_exe_path(),
                        cmdline.rustfmt_exe_path(),
-                       cmdline.rustfmt_config_path(), generate_error_report));
+                       cmdline.rustfmt_config_path(), rs_api_shards_path,
+                       generate_error_report,
+                       cmdline.compact_layout_assertions()));
 
+  llvm::TimeTraceScope time_trace("CollectMetadata");
   absl::flat_hash_map<std::string, std::string> instantiations;
   std::optional<const Namespace*> ns =
       FindNamespace(ir, kInstantiationsNamespaceName);
@@ -97,12 +136,21 @@ absl::StatusOr<BindingsAndMetadata> GenerateBindingsAndMetadata(
     }
   }
 
+  if (!cache_key.empty()) {
+    CRUBIT_RETURN_IF_ERROR(StoreInInstantiationsCache(
+        cmdline.instantiations_cache_dir(), cache_key,
+        CachedInstantiations{.rs_api = bindings.rs_api,
+                             .rs_api_impl = bindings.rs_api_impl,
+                             .instantiations = instantiations}));
+  }
+
   auto top_level_namespaces = crubit::CollectNamespaces(ir);
 
   return BindingsAndMetadata{
       .ir = ir,
       .rs_api = bindings.rs_api,
       .rs_api_impl = bindings.rs_api_impl,
+      .rs_api_shards = std::move(bindings.rs_api_shards),
       .namespaces = std::move(top_level_namespaces),
       .instantiations = std::move(instantiations),
       .error_report = bindings.error_report,
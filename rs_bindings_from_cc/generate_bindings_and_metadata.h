@@ -5,6 +5,7 @@
 #ifndef THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_GENERATE_BINDINGS_AND_METADATA_H_
 #define THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_GENERATE_BINDINGS_AND_METADATA_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,9 @@ struct BindingsAndMetadata {
   std::string rs_api;
   // Generated C++ source code.
   std::string rs_api_impl;
+  // Generated Rust source code of the modules split out of `rs_api`, keyed by
+  // file name (relative to `Cmdline::rs_out_shards_dir()`).
+  std::map<std::string, std::string> rs_api_shards;
   // A hierarchy tree for all C++ namespaces used in the target.
   NamespacesHierarchy namespaces;
   // C++ class templates explicitly instantiated in this TU and their Rust
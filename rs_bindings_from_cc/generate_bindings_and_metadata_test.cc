@@ -10,6 +10,7 @@
 #include "gtest/gtest.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "common/status_macros.h"
 #include "common/test_utils.h"
@@ -22,6 +23,7 @@ namespace {
 
 using ::testing::ElementsAre;
 using ::testing::IsEmpty;
+using ::testing::Not;
 using ::testing::Pair;
 using ::testing::StrEq;
 
@@ -47,7 +49,10 @@ TEST(GenerateBindingsAndMetadataTest, GeneratingIR) {
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
           /* instantiations_out= */ "",
-          /* error_report_out= */ ""));
+          /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""));
 
   ASSERT_OK_AND_ASSIGN(
       BindingsAndMetadata result,
@@ -79,7 +84,10 @@ TEST(GenerateBindingsAndMetadataTest, InstantiationsAreEmptyInNormalMode) {
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
           /* instantiations_out= */ "",
-          /* error_report_out= */ ""));
+          /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""));
 
   ASSERT_OK_AND_ASSIGN(
       BindingsAndMetadata result,
@@ -109,7 +117,10 @@ GetInstantiationsFor(absl::string_view header_content,
           {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {a_rs_path},
-          "instantiations_out", /* error_report_out= */ ""));
+          "instantiations_out", /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""));
 
   CRUBIT_ASSIGN_OR_RETURN(
       BindingsAndMetadata result,
@@ -276,7 +287,10 @@ TEST(GenerateBindingsAndMetadataTest, NamespacesJsonGenerated) {
           /* public_headers= */ {"a.h"}, std::string(kTargetsAndHeaders),
           /* extra_rs_srcs= */ {},
           /* srcs_to_scan_for_instantiations= */ {},
-          /* instantiations_out= */ "", /* error_report_out= */ ""));
+          /* instantiations_out= */ "", /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false,
+          /* instantiations_cache_dir= */ ""));
   ASSERT_OK_AND_ASSIGN(BindingsAndMetadata result,
                        GenerateBindingsAndMetadata(
                            cmdline, DefaultClangArgs(),
@@ -286,5 +300,109 @@ TEST(GenerateBindingsAndMetadataTest, NamespacesJsonGenerated) {
   ASSERT_THAT(NamespacesAsJson(result.namespaces), StrEq(kExpected));
 }
 
+absl::StatusOr<BindingsAndMetadata> GenerateInstantiationsWithCache(
+    std::string target, absl::string_view header_content,
+    absl::string_view rust_source, std::string cache_dir) {
+  std::string lib_rs_path = WriteFileForCurrentTest(
+      absl::StrCat(target.substr(target.find(':') + 1), ".rs"), rust_source);
+  std::string targets_and_headers =
+      absl::StrCat(R"([{"t": ")", target, R"(", "h": ["a.h"]}])");
+
+  CRUBIT_ASSIGN_OR_RETURN(
+      Cmdline cmdline,
+      Cmdline::CreateForTesting(
+          std::move(target), "cc_out", "rs_out", /* ir_out= */ "",
+          /* namespaces_out= */ "", "crubit_support_path",
+          std::string(kDefaultClangFormatExePath),
+          std::string(kDefaultRustfmtExePath), "nowhere/rustfmt.toml",
+          /* do_nothing= */ false,
+          /* public_headers= */ {"a.h"}, std::move(targets_and_headers),
+          /* extra_rs_srcs= */ {},
+          /* srcs_to_scan_for_instantiations= */ {lib_rs_path},
+          "instantiations_out", /* error_report_out= */ "",
+          /* shard_rs_out= */ false, /* profile_out= */ "",
+          /* compact_layout_assertions= */ false, std::move(cache_dir)));
+  return GenerateBindingsAndMetadata(
+      cmdline, DefaultClangArgs(),
+      /* virtual_headers_contents= */
+      {{HeaderName("a.h"), std::string(header_content)}});
+}
+
+TEST(GenerateBindingsAndMetadataTest, InstantiationsAreSharedAcrossTargets) {
+  constexpr absl::string_view kHeaderContent = R"cc(
+    template <typename T>
+    struct MyTemplate {
+      T value;
+    };
+  )cc";
+  std::string cache_dir =
+      absl::StrCat(testing::TempDir(), "/instantiations_cache");
+
+  ASSERT_OK_AND_ASSIGN(
+      BindingsAndMetadata first,
+      GenerateInstantiationsWithCache(
+          "//:target1", kHeaderContent,
+          "cc_template!{MyTemplate<int>}", cache_dir));
+  EXPECT_THAT(first.ir.items, Not(IsEmpty()));
+
+  // A different crate that requests the same instantiation gets the bindings
+  // from the store, without importing the headers again (hence the empty IR).
+  ASSERT_OK_AND_ASSIGN(
+      BindingsAndMetadata second,
+      GenerateInstantiationsWithCache(
+          "//:target2", kHeaderContent,
+          "fn f(_: cc_template!{MyTemplate<int>}) {}", cache_dir));
+  EXPECT_THAT(second.ir.items, IsEmpty());
+  EXPECT_EQ(second.rs_api, first.rs_api);
+  EXPECT_EQ(second.rs_api_impl, first.rs_api_impl);
+  EXPECT_THAT(second.instantiations,
+              ElementsAre(Pair("MyTemplate<int>",
+                               "__CcTemplateInst10MyTemplateIiE")));
+
+  // Requesting other instantiations doesn't hit the store.
+  ASSERT_OK_AND_ASSIGN(
+      BindingsAndMetadata third,
+      GenerateInstantiationsWithCache(
+          "//:target3", kHeaderContent,
+          "cc_template!{MyTemplate<bool>}", cache_dir));
+  EXPECT_THAT(third.ir.items, Not(IsEmpty()));
+  EXPECT_THAT(third.instantiations,
+              ElementsAre(Pair("MyTemplate<bool>",
+                               "__CcTemplateInst10MyTemplateIbE")));
+}
+
+TEST(GenerateBindingsAndMetadataTest, ChangedHeadersDontHitInstantiations) {
+  std::string cache_dir =
+      absl::StrCat(testing::TempDir(), "/instantiations_cache_changed_headers");
+
+  ASSERT_OK_AND_ASSIGN(
+      BindingsAndMetadata first,
+      GenerateInstantiationsWithCache("//:target1", R"cc(
+        template <typename T>
+        struct MyTemplate {
+          T value;
+        };
+      )cc",
+                                      "cc_template!{MyTemplate<int>}",
+                                      cache_dir));
+  EXPECT_THAT(first.ir.items, Not(IsEmpty()));
+
+  // The same instantiation of a template whose definition changed must be
+  // generated again.
+  ASSERT_OK_AND_ASSIGN(
+      BindingsAndMetadata second,
+      GenerateInstantiationsWithCache("//:target2", R"cc(
+        template <typename T>
+        struct MyTemplate {
+          T value;
+          T other_value;
+        };
+      )cc",
+                                      "cc_template!{MyTemplate<int>}",
+                                      cache_dir));
+  EXPECT_THAT(second.ir.items, Not(IsEmpty()));
+  EXPECT_NE(second.rs_api, first.rs_api);
+}
+
 }  // namespace
 }  // namespace crubit
@@ -0,0 +1,284 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Benchmarks for the phases of `rs_bindings_from_cc`, run against synthetic
+// headers whose size and shape are controlled by the benchmark arguments.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/flags/declare.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/substitute.h"
+#include "rs_bindings_from_cc/bazel_types.h"
+#include "rs_bindings_from_cc/cmdline.h"
+#include "rs_bindings_from_cc/generate_bindings_and_metadata.h"
+#include "rs_bindings_from_cc/ir.h"
+#include "rs_bindings_from_cc/ir_from_cc.h"
+#include "rs_bindings_from_cc/src_code_gen.h"
+
+// Defined in cmdline.cc. The benchmarks format the generated code with the
+// same tools as `rs_bindings_from_cc`, so they need to be told where they are.
+ABSL_DECLARE_FLAG(std::string, clang_format_exe_path);
+ABSL_DECLARE_FLAG(std::string, rustfmt_exe_path);
+
+// Counts allocations made through the global C++ `operator new`. Allocations
+// made by the Rust code generator go through the Rust allocator and are not
+// counted.
+static std::atomic<int64_t> allocation_count = 0;
+static std::atomic<int64_t> allocated_bytes = 0;
+
+void* operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace crubit {
+namespace {
+
+constexpr absl::string_view kHeaderName = "benchmark.h";
+
+// Reports the allocations made through `operator new` while a benchmark runs.
+class AllocationCounter : public benchmark::MemoryManager {
+ public:
+  void Start() override {
+    allocation_count = 0;
+    allocated_bytes = 0;
+  }
+
+  void Stop(Result& result) override {
+    result.num_allocs = allocation_count;
+    result.total_allocated_bytes = allocated_bytes;
+  }
+};
+
+// Shape of a synthetic header.
+struct SyntheticHeader {
+  // Number of (non-template) records.
+  int records = 0;
+  // Number of methods in each record.
+  int methods_per_record = 0;
+  // Number of nested namespaces around all the records.
+  int namespace_depth = 0;
+  // Number of distinct instantiations of a class template.
+  int template_instantiations = 0;
+  // Number of comment lines before each record and method.
+  int comment_lines = 0;
+};
+
+std::string CommentLines(int lines, absl::string_view indent) {
+  std::string result;
+  for (int i = 0; i < lines; ++i) {
+    absl::SubstituteAndAppend(&result, "$0// Comment line $1.\n", indent, i);
+  }
+  return result;
+}
+
+std::string MakeSyntheticHeader(const SyntheticHeader& shape) {
+  std::string result = "#pragma once\n";
+  for (int i = 0; i < shape.namespace_depth; ++i) {
+    absl::SubstituteAndAppend(&result, "namespace ns$0 {\n", i);
+  }
+  for (int i = 0; i < shape.records; ++i) {
+    absl::StrAppend(&result, CommentLines(shape.comment_lines, ""));
+    absl::SubstituteAndAppend(&result, "struct Record$0 {\n", i);
+    for (int j = 0; j < shape.methods_per_record; ++j) {
+      absl::StrAppend(&result, CommentLines(shape.comment_lines, "  "));
+      absl::SubstituteAndAppend(
+          &result, "  inline int Method$0(int x) const { return x + $0; }\n",
+          j);
+    }
+    absl::StrAppend(&result, "  int field;\n};\n");
+  }
+  if (shape.template_instantiations > 0) {
+    absl::StrAppend(&result,
+                    "template <int N>\n"
+                    "struct Template {\n"
+                    "  int Get() const { return value + N; }\n"
+                    "  int value;\n"
+                    "};\n");
+    for (int i = 0; i < shape.template_instantiations; ++i) {
+      absl::SubstituteAndAppend(&result,
+                                "using Instantiation$0 = Template<$0>;\n", i);
+    }
+  }
+  for (int i = shape.namespace_depth - 1; i >= 0; --i) {
+    absl::SubstituteAndAppend(&result, "}  // namespace ns$0\n", i);
+  }
+  return result;
+}
+
+// Benchmark arguments: {records, methods_per_record}.
+SyntheticHeader RecordsShape(const benchmark::State& state) {
+  return SyntheticHeader{
+      .records = static_cast<int>(state.range(0)),
+      .methods_per_record = static_cast<int>(state.range(1)),
+  };
+}
+
+void SetItemCounters(benchmark::State& state, const IR& ir) {
+  state.counters["ir_items"] = ir.items.size();
+}
+
+IR IrFromSyntheticHeader(const SyntheticHeader& shape) {
+  absl::StatusOr<IR> ir = IrFromCc(MakeSyntheticHeader(shape));
+  CHECK(ir.ok()) << ir.status();
+  return *std::move(ir);
+}
+
+void BenchmarkIrFromCc(benchmark::State& state, const SyntheticHeader& shape) {
+  std::string header = MakeSyntheticHeader(shape);
+  for (auto _ : state) {
+    absl::StatusOr<IR> ir = IrFromCc(header);
+    CHECK(ir.ok()) << ir.status();
+    SetItemCounters(state, *ir);
+    benchmark::DoNotOptimize(ir);
+  }
+  state.SetBytesProcessed(state.iterations() * header.size());
+}
+
+void BM_IrFromCc_Records(benchmark::State& state) {
+  BenchmarkIrFromCc(state, RecordsShape(state));
+}
+BENCHMARK(BM_IrFromCc_Records)
+    ->ArgsProduct({{10, 100, 1000}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+void BM_IrFromCc_DeepNamespaces(benchmark::State& state) {
+  BenchmarkIrFromCc(state, SyntheticHeader{
+                               .records = 10,
+                               .methods_per_record = 1,
+                               .namespace_depth =
+                                   static_cast<int>(state.range(0)),
+                           });
+}
+BENCHMARK(BM_IrFromCc_DeepNamespaces)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_IrFromCc_TemplateInstantiations(benchmark::State& state) {
+  BenchmarkIrFromCc(state, SyntheticHeader{
+                               .template_instantiations =
+                                   static_cast<int>(state.range(0)),
+                           });
+}
+BENCHMARK(BM_IrFromCc_TemplateInstantiations)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_IrFromCc_DenseComments(benchmark::State& state) {
+  BenchmarkIrFromCc(state, SyntheticHeader{
+                               .records = 100,
+                               .methods_per_record = 10,
+                               .comment_lines =
+                                   static_cast<int>(state.range(0)),
+                           });
+}
+BENCHMARK(BM_IrFromCc_DenseComments)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond);
+
+void BenchmarkGenerateBindings(benchmark::State& state,
+                               bool compact_layout_assertions) {
+  IR ir = IrFromSyntheticHeader(RecordsShape(state));
+  SetItemCounters(state, ir);
+  for (auto _ : state) {
+    absl::StatusOr<Bindings> bindings = GenerateBindings(
+        ir, "crubit/rs_bindings_support",
+        absl::GetFlag(FLAGS_clang_format_exe_path),
+        absl::GetFlag(FLAGS_rustfmt_exe_path), /* rustfmt_config_path= */"",
+        /* rs_api_shards_path= */"", /* generate_error_report= */false,
+        compact_layout_assertions);
+    CHECK(bindings.ok()) << bindings.status();
+    state.counters["rs_api_bytes"] = bindings->rs_api.size();
+    state.counters["rs_api_impl_bytes"] = bindings->rs_api_impl.size();
+    benchmark::DoNotOptimize(bindings);
+  }
+}
+
+void BM_GenerateBindings(benchmark::State& state) {
+  BenchmarkGenerateBindings(state, /* compact_layout_assertions= */false);
+}
+BENCHMARK(BM_GenerateBindings)
+    ->ArgsProduct({{10, 100, 1000}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+// Compared to `BM_GenerateBindings`, the `rs_api_bytes` and `rs_api_impl_bytes`
+// counters show how much smaller the generated code gets.
+void BM_GenerateBindings_CompactLayoutAssertions(benchmark::State& state) {
+  BenchmarkGenerateBindings(state, /* compact_layout_assertions= */true);
+}
+BENCHMARK(BM_GenerateBindings_CompactLayoutAssertions)
+    ->ArgsProduct({{10, 100, 1000}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+void BM_GenerateBindingsAndMetadata(benchmark::State& state) {
+  std::string header = MakeSyntheticHeader(RecordsShape(state));
+  std::string targets_and_headers =
+      absl::Substitute(R"([{"t": "//:target", "h": ["$0"]}])", kHeaderName);
+  absl::StatusOr<Cmdline> cmdline = Cmdline::CreateForTesting(
+      "//:target", "cc_out", "rs_out", /* ir_out= */"", /* namespaces_out= */"",
+      "crubit/rs_bindings_support", absl::GetFlag(FLAGS_clang_format_exe_path),
+      absl::GetFlag(FLAGS_rustfmt_exe_path), /* rustfmt_config_path= */"",
+      /* do_nothing= */false, {std::string(kHeaderName)}, targets_and_headers,
+      /* extra_rs_srcs= */{}, /* srcs_to_scan_for_instantiations= */{},
+      /* instantiations_out= */"", /* error_report_out= */"",
+      /* shard_rs_out= */false, /* profile_out= */"",
+      /* compact_layout_assertions= */false,
+      /* instantiations_cache_dir= */"");
+  CHECK(cmdline.ok()) << cmdline.status();
+  for (auto _ : state) {
+    absl::StatusOr<BindingsAndMetadata> result = GenerateBindingsAndMetadata(
+        *cmdline, /* clang_args= */{},
+        {{HeaderName(std::string(kHeaderName)), header}});
+    CHECK(result.ok()) << result.status();
+    SetItemCounters(state, result->ir);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_GenerateBindingsAndMetadata)
+    ->ArgsProduct({{10, 100, 1000}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace crubit
+
+int main(int argc, char** argv) {
+  crubit::AllocationCounter allocation_counter;
+  benchmark::RegisterMemoryManager(&allocation_counter);
+  benchmark::Initialize(&argc, argv);
+  absl::ParseCommandLine(argc, argv);
+  if (absl::GetFlag(FLAGS_clang_format_exe_path).empty() ||
+      absl::GetFlag(FLAGS_rustfmt_exe_path).empty()) {
+    std::cerr << "please specify --clang_format_exe_path and "
+                 "--rustfmt_exe_path"
+              << std::endl;
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::RegisterMemoryManager(nullptr);
+  benchmark::Shutdown();
+  return 0;
+}
@@ -39,8 +39,10 @@
 #include "clang/AST/DeclBase.h"
 #include "clang/AST/DeclCXX.h"
 #include "clang/AST/DeclFriend.h"
+#include "clang/AST/DeclTemplate.h"
 #include "clang/AST/Mangle.h"
 #include "clang/AST/RawCommentList.h"
+#include "clang/AST/RecordLayout.h"
 #include "clang/AST/Type.h"
 #include "clang/Basic/FileManager.h"
 #include "clang/Basic/LLVM.h"
@@ -54,6 +56,7 @@
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/Regex.h"
+#include "llvm/Support/TimeProfiler.h"
 
 namespace crubit {
 namespace {
@@ -72,6 +75,37 @@ absl::Status CheckImportStatus(const std::optional<IR::Item>& item) {
   }
   return absl::OkStatus();
 }
+
+// Returns true if `view` (an `absl::Span<T>` or a `std::span<T>`) consists of a
+// `T*` followed by a `size_t`, and is trivially copyable, so that it can be
+// passed by value as a `::slice_ref::SliceRef<T>` / `::slice_ref::SliceMut<T>`.
+bool HasPointerAndLengthLayout(
+    clang::Sema& sema, const clang::ClassTemplateSpecializationDecl* view,
+    clang::QualType element_type) {
+  clang::ASTContext& ctx = sema.getASTContext();
+  if (!sema.isCompleteType(view->getLocation(), ctx.getRecordType(view))) {
+    return false;
+  }
+  const clang::CXXRecordDecl* definition = view->getDefinition();
+  if (definition == nullptr || !definition->isTriviallyCopyable() ||
+      definition->getNumBases() != 0) {
+    return false;
+  }
+  std::vector<const clang::FieldDecl*> fields(definition->field_begin(),
+                                              definition->field_end());
+  if (fields.size() != 2 || fields[0]->isBitField() ||
+      fields[1]->isBitField() || !fields[0]->getType()->isPointerType() ||
+      !ctx.hasSameType(fields[0]->getType()->getPointeeType(), element_type) ||
+      !ctx.hasSameType(fields[1]->getType(), ctx.getSizeType())) {
+    return false;
+  }
+  const clang::ASTRecordLayout& layout = ctx.getASTRecordLayout(definition);
+  uint64_t pointer_size = ctx.getTypeSize(fields[0]->getType());
+  return pointer_size == ctx.getTypeSize(ctx.getSizeType()) &&
+         layout.getFieldOffset(0) == 0 &&
+         layout.getFieldOffset(1) == pointer_size &&
+         ctx.toBits(layout.getSize()) == 2 * pointer_size;
+}
 }  // namespace
 
 namespace {
@@ -404,6 +438,7 @@ void Importer::ImportFreeComments() {
 }
 
 void Importer::Import(clang::TranslationUnitDecl* translation_unit_decl) {
+  llvm::TimeTraceScope time_trace("Importer::Import");
   ImportFreeComments();
   clang::SourceManager& sm = ctx_.getSourceManager();
   std::vector<SourceLocationComparator::OrderedItem> ordered_items;
@@ -553,6 +588,12 @@ std::optional<IR::Item> Importer::ImportDecl(clang::Decl* decl) {
   std::optional<IR::Item> result;
   for (auto& importer : decl_importers_) {
     if (importer->CanImport(decl)) {
+      // Only build the (per-decl-kind) event name if somebody is listening.
+      std::optional<llvm::TimeTraceScope> time_trace;
+      if (llvm::timeTraceProfilerEnabled()) {
+        time_trace.emplace(
+            absl::StrCat("Import", decl->getDeclKindName(), "Decl"));
+      }
       result = importer->ImportDecl(decl);
     }
   }
@@ -743,6 +784,46 @@ absl::StatusOr<MappedType> Importer::ConvertTemplateSpecializationType(
   return ConvertTypeDecl(specialization_decl);
 }
 
+absl::StatusOr<std::optional<MappedType>> Importer::ConvertContiguousViewType(
+    const clang::Type* type) {
+  const auto* specialization_decl =
+      clang::dyn_cast_or_null<clang::ClassTemplateSpecializationDecl>(
+          type->getAsCXXRecordDecl());
+  if (specialization_decl == nullptr) return std::nullopt;
+
+  // Both `absl::Span<T>` and `std::span<T, std::dynamic_extent>` consist of a
+  // `T*` followed by a `size_t`, which is also the layout of
+  // `::slice_ref::SliceRef<T>` and `::slice_ref::SliceMut<T>`. (`std::span`s
+  // with a static extent don't store the size.)
+  const clang::TemplateArgumentList& args =
+      specialization_decl->getTemplateArgs();
+  std::string name = specialization_decl->getQualifiedNameAsString();
+  if (name == "absl::Span") {
+    if (args.size() != 1) return std::nullopt;
+  } else if (name == "std::span") {
+    if (args.size() != 2 ||
+        args[1].getKind() != clang::TemplateArgument::Integral ||
+        !args[1].getAsIntegral().isAllOnesValue()) {
+      return std::nullopt;
+    }
+  } else {
+    return std::nullopt;
+  }
+  if (args[0].getKind() != clang::TemplateArgument::Type) return std::nullopt;
+  // Other layouts (e.g. with the length first) are imported as records.
+  if (!HasPointerAndLengthLayout(sema_, specialization_decl,
+                                 args[0].getAsType())) {
+    return std::nullopt;
+  }
+
+  std::optional<clang::tidy::lifetimes::ValueLifetimes> no_lifetimes;
+  CRUBIT_ASSIGN_OR_RETURN(MappedType element_type,
+                          ConvertQualType(args[0].getAsType(), no_lifetimes));
+  return MappedType::SliceOf(
+      std::move(element_type),
+      ctx_.getRecordType(specialization_decl).getAsString());
+}
+
 absl::StatusOr<MappedType> Importer::ConvertTypeDecl(clang::TypeDecl* decl) {
   if (!EnsureSuccessfullyImported(decl)) {
     return absl::NotFoundError(absl::Substitute(
@@ -760,6 +841,12 @@ absl::StatusOr<MappedType> Importer::ConvertType(
   // Qualifiers are handled separately in ConvertQualType().
   std::string type_string = clang::QualType(type, 0).getAsString();
 
+  CRUBIT_ASSIGN_OR_RETURN(std::optional<MappedType> contiguous_view_type,
+                          ConvertContiguousViewType(type));
+  if (contiguous_view_type.has_value()) {
+    return *std::move(contiguous_view_type);
+  }
+
   if (auto maybe_mapped_type = MapKnownCcTypeToRsType(type_string);
       maybe_mapped_type.has_value()) {
     return MappedType::Simple(std::string(*maybe_mapped_type), type_string);
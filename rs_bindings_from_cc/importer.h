@@ -127,6 +127,12 @@ class Importer final : public ImportContext {
   absl::StatusOr<MappedType> ConvertTemplateSpecializationType(
       const clang::TemplateSpecializationType* type);
 
+  // Converts contiguous views (`absl::Span<T>` and `std::span<T>` with a
+  // dynamic extent) into slice types, or returns `std::nullopt` if `type` is
+  // not a contiguous view.
+  absl::StatusOr<std::optional<MappedType>> ConvertContiguousViewType(
+      const clang::Type* type);
+
   std::vector<std::unique_ptr<DeclImporter>> decl_importers_;
   std::unique_ptr<clang::MangleContext> mangler_;
   absl::flat_hash_map<const clang::Decl*, std::optional<IR::Item>>
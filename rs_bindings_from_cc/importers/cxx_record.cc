@@ -13,6 +13,7 @@
 #include "absl/log/log.h"
 #include "rs_bindings_from_cc/ast_convert.h"
 #include "clang/AST/ASTContext.h"
+#include "clang/AST/Attr.h"
 #include "clang/AST/CXXInheritance.h"
 #include "clang/AST/Decl.h"
 #include "clang/AST/PrettyPrinter.h"
@@ -46,6 +47,15 @@ const absl::flat_hash_set<absl::string_view>& FinalOverrides() {
   return final_overrides;
 }
 
+// Returns true if `record_decl` is annotated with
+// `[[clang::annotate("crubit_bulk_thunks")]]`.
+bool HasBulkThunksAnnotation(const clang::CXXRecordDecl& record_decl) {
+  for (const auto* attr : record_decl.specific_attrs<clang::AnnotateAttr>()) {
+    if (attr->getAnnotation() == "crubit_bulk_thunks") return true;
+  }
+  return false;
+}
+
 std::string GetClassTemplateSpecializationCcName(
     const clang::ASTContext& ast_context,
     const clang::ClassTemplateSpecializationDecl* specialization_decl,
@@ -265,6 +275,7 @@ std::optional<IR::Item> CXXRecordDeclImporter::Import(
       .record_type = *record_type,
       .is_aggregate = record_decl->isAggregate(),
       .is_anon_record_with_typedef = anon_typedef != nullptr,
+      .has_bulk_thunks = HasBulkThunksAnnotation(*record_decl),
       .is_explicit_class_template_instantiation_definition =
           is_explicit_class_template_instantiation_definition,
       .child_item_ids = std::move(item_ids),
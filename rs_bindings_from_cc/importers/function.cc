@@ -8,6 +8,9 @@
 
 #include "absl/strings/substitute.h"
 #include "rs_bindings_from_cc/ast_util.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/Stmt.h"
 #include "clang/Sema/Sema.h"
 #include "llvm/ADT/StringRef.h"
 
@@ -23,6 +26,249 @@ static bool IsInStdNamespace(const clang::FunctionDecl* decl) {
   return false;
 }
 
+// Returns `expr` without the parentheses and implicit conversions that change
+// neither its value nor its type (e.g. lvalue-to-rvalue conversions).
+static const clang::Expr* IgnoreValuePreservingNodes(const clang::Expr* expr) {
+  while (true) {
+    expr = expr->IgnoreParens();
+    if (const auto* full_expr = clang::dyn_cast<clang::FullExpr>(expr)) {
+      expr = full_expr->getSubExpr();
+      continue;
+    }
+    if (const auto* cast = clang::dyn_cast<clang::ImplicitCastExpr>(expr);
+        cast != nullptr && (cast->getCastKind() == clang::CK_LValueToRValue ||
+                            cast->getCastKind() == clang::CK_NoOp)) {
+      expr = cast->getSubExpr();
+      continue;
+    }
+    return expr;
+  }
+}
+
+// Returns whether values of `type` can appear in an `InlineExpr`.
+//
+// Integer types narrower than `int` are excluded, because C++ promotes them to
+// `int` before doing arithmetic on them, and Rust doesn't.
+static bool IsInlineExprType(clang::QualType type) {
+  const auto* builtin_type = type->getAs<clang::BuiltinType>();
+  if (builtin_type == nullptr) return false;
+  switch (builtin_type->getKind()) {
+    case clang::BuiltinType::Bool:
+    case clang::BuiltinType::Int:
+    case clang::BuiltinType::UInt:
+    case clang::BuiltinType::Long:
+    case clang::BuiltinType::ULong:
+    case clang::BuiltinType::LongLong:
+    case clang::BuiltinType::ULongLong:
+    case clang::BuiltinType::Float:
+    case clang::BuiltinType::Double:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool IsIntegral(clang::QualType type) {
+  return type->isIntegerType() && !type->isBooleanType();
+}
+
+std::optional<InlineExpr> FunctionDeclImporter::ImportInlineBody(
+    const clang::FunctionDecl& function_decl) {
+  if (!function_decl.isInlined()) return std::nullopt;
+  // Constructors, destructors and operators are bound to Rust traits, which
+  // always go through a thunk.
+  if (!function_decl.getDeclName().isIdentifier()) return std::nullopt;
+  if (const auto* method_decl =
+          clang::dyn_cast<clang::CXXMethodDecl>(&function_decl)) {
+    if (method_decl->isVirtual() ||
+        method_decl->getRefQualifier() == clang::RQ_RValue) {
+      return std::nullopt;
+    }
+  }
+
+  const clang::FunctionDecl* definition = nullptr;
+  if (!function_decl.hasBody(definition)) return std::nullopt;
+  const auto* body =
+      llvm::dyn_cast_or_null<clang::CompoundStmt>(definition->getBody());
+  if (body == nullptr || body->size() != 1) return std::nullopt;
+  const auto* return_stmt =
+      clang::dyn_cast<clang::ReturnStmt>(body->body_front());
+  if (return_stmt == nullptr || return_stmt->getRetValue() == nullptr) {
+    return std::nullopt;
+  }
+  return ImportInlineExpr(*definition, return_stmt->getRetValue(),
+                          definition->getReturnType());
+}
+
+std::optional<InlineExpr> FunctionDeclImporter::ImportInlineExpr(
+    const clang::FunctionDecl& function_decl, const clang::Expr* expr,
+    clang::QualType type) {
+  type = type.getCanonicalType().getUnqualifiedType();
+  if (!IsInlineExprType(type)) return std::nullopt;
+  std::optional<clang::tidy::lifetimes::ValueLifetimes> no_lifetimes;
+
+  expr = IgnoreValuePreservingNodes(expr);
+  const auto* integer_literal = clang::dyn_cast<clang::IntegerLiteral>(expr);
+  if (const auto* cast = clang::dyn_cast<clang::ImplicitCastExpr>(expr);
+      cast != nullptr && cast->getCastKind() == clang::CK_IntegralCast) {
+    // The only conversion allowed is that of an integer literal to the type of
+    // the other operand (e.g. `1` in `x + 1` where `x` is a `long`), and only
+    // if the value of the literal doesn't change.
+    integer_literal = clang::dyn_cast<clang::IntegerLiteral>(
+        IgnoreValuePreservingNodes(cast->getSubExpr()));
+    if (integer_literal == nullptr) return std::nullopt;
+    unsigned value_bits = ictx_.ctx_.getIntWidth(type);
+    if (type->isSignedIntegerType()) --value_bits;
+    if (integer_literal->getValue().getActiveBits() > value_bits) {
+      return std::nullopt;
+    }
+  } else if (expr->getType().getCanonicalType().getUnqualifiedType() != type) {
+    return std::nullopt;
+  }
+
+  if (integer_literal != nullptr) {
+    absl::StatusOr<MappedType> literal_type =
+        ictx_.ConvertQualType(type, no_lifetimes);
+    if (!literal_type.ok()) return std::nullopt;
+    return InlineExpr{
+        .kind = InlineExpr::kIntegerLiteral,
+        .integer_literal = IntegerConstant(
+            llvm::APSInt(integer_literal->getValue(), /*isUnsigned=*/true)),
+        .type = *std::move(literal_type),
+    };
+  }
+
+  if (const auto* bool_literal =
+          clang::dyn_cast<clang::CXXBoolLiteralExpr>(expr)) {
+    return InlineExpr{.kind = InlineExpr::kBoolLiteral,
+                      .bool_literal = bool_literal->getValue()};
+  }
+
+  if (const auto* decl_ref = clang::dyn_cast<clang::DeclRefExpr>(expr)) {
+    const auto* param_decl =
+        clang::dyn_cast<clang::ParmVarDecl>(decl_ref->getDecl());
+    // Reference parameters have the type of their referent in expressions.
+    if (param_decl == nullptr ||
+        param_decl->getDeclContext() != &function_decl ||
+        param_decl->getType().getCanonicalType().getUnqualifiedType() !=
+            type) {
+      return std::nullopt;
+    }
+    // `Func::params` starts with `__this` for instance methods.
+    int param_index = param_decl->getFunctionScopeIndex();
+    if (const auto* method_decl =
+            clang::dyn_cast<clang::CXXMethodDecl>(&function_decl);
+        method_decl != nullptr && method_decl->isInstance()) {
+      ++param_index;
+    }
+    return InlineExpr{.kind = InlineExpr::kParam, .param_index = param_index};
+  }
+
+  if (const auto* member_expr = clang::dyn_cast<clang::MemberExpr>(expr)) {
+    const auto* field_decl =
+        clang::dyn_cast<clang::FieldDecl>(member_expr->getMemberDecl());
+    const auto* method_decl =
+        clang::dyn_cast<clang::CXXMethodDecl>(&function_decl);
+    // Only fields declared directly in the class of the method are supported,
+    // because the bindings access them by name.
+    if (field_decl == nullptr || field_decl->isBitField() ||
+        method_decl == nullptr || !member_expr->isArrow() ||
+        !clang::isa<clang::CXXThisExpr>(
+            IgnoreValuePreservingNodes(member_expr->getBase())) ||
+        field_decl->getParent() != method_decl->getParent() ||
+        field_decl->getType().getCanonicalType().getUnqualifiedType() !=
+            type) {
+      return std::nullopt;
+    }
+    std::optional<Identifier> field_name =
+        ictx_.GetTranslatedIdentifier(field_decl);
+    absl::StatusOr<MappedType> field_type =
+        ictx_.ConvertQualType(type, no_lifetimes);
+    if (!field_name.has_value() || !field_type.ok()) return std::nullopt;
+    return InlineExpr{
+        .kind = InlineExpr::kField,
+        .field = *std::move(field_name),
+        .type = *std::move(field_type),
+    };
+  }
+
+  if (const auto* unary_op = clang::dyn_cast<clang::UnaryOperator>(expr)) {
+    switch (unary_op->getOpcode()) {
+      case clang::UO_Minus:
+        if (type->isBooleanType()) return std::nullopt;
+        break;
+      case clang::UO_Not:
+        if (!IsIntegral(type)) return std::nullopt;
+        break;
+      case clang::UO_LNot:
+        if (!type->isBooleanType()) return std::nullopt;
+        break;
+      default:
+        return std::nullopt;
+    }
+    std::optional<InlineExpr> operand =
+        ImportInlineExpr(function_decl, unary_op->getSubExpr(), type);
+    if (!operand.has_value()) return std::nullopt;
+    return InlineExpr{
+        .kind = InlineExpr::kUnaryOp,
+        .op = clang::UnaryOperator::getOpcodeStr(unary_op->getOpcode()).str(),
+        .is_integral = IsIntegral(type),
+        .operands = {*std::move(operand)},
+    };
+  }
+
+  if (const auto* binary_op = clang::dyn_cast<clang::BinaryOperator>(expr)) {
+    // After the usual arithmetic conversions, both operands have the same type.
+    clang::QualType operand_type =
+        binary_op->getLHS()->getType().getCanonicalType().getUnqualifiedType();
+    switch (binary_op->getOpcode()) {
+      case clang::BO_Add:
+      case clang::BO_Sub:
+      case clang::BO_Mul:
+        if (type->isBooleanType()) return std::nullopt;
+        break;
+      case clang::BO_Div:
+        // Integer division has corner cases (division by zero, `INT_MIN / -1`)
+        // that are undefined behavior in C++ and panic in Rust.
+        if (!type->isRealFloatingType()) return std::nullopt;
+        break;
+      case clang::BO_And:
+      case clang::BO_Or:
+      case clang::BO_Xor:
+        if (!IsIntegral(type)) return std::nullopt;
+        break;
+      case clang::BO_LAnd:
+      case clang::BO_LOr:
+        if (!type->isBooleanType()) return std::nullopt;
+        break;
+      case clang::BO_EQ:
+      case clang::BO_NE:
+      case clang::BO_LT:
+      case clang::BO_GT:
+      case clang::BO_LE:
+      case clang::BO_GE:
+        if (!type->isBooleanType()) return std::nullopt;
+        break;
+      default:
+        return std::nullopt;
+    }
+    std::optional<InlineExpr> lhs =
+        ImportInlineExpr(function_decl, binary_op->getLHS(), operand_type);
+    if (!lhs.has_value()) return std::nullopt;
+    std::optional<InlineExpr> rhs =
+        ImportInlineExpr(function_decl, binary_op->getRHS(), operand_type);
+    if (!rhs.has_value()) return std::nullopt;
+    return InlineExpr{
+        .kind = InlineExpr::kBinaryOp,
+        .op = binary_op->getOpcodeStr().str(),
+        .is_integral = IsIntegral(operand_type),
+        .operands = {*std::move(lhs), *std::move(rhs)},
+    };
+  }
+
+  return std::nullopt;
+}
+
 std::optional<IR::Item> FunctionDeclImporter::Import(
     clang::FunctionDecl* function_decl) {
   if (!ictx_.IsFromCurrentTarget(function_decl)) return std::nullopt;
@@ -188,6 +434,8 @@ std::optional<IR::Item> FunctionDeclImporter::Import(
           .reference = reference,
           .is_const = method_decl->isConst(),
           .is_virtual = method_decl->isVirtual(),
+          .is_final = method_decl->hasAttr<clang::FinalAttr>() ||
+                      method_decl->getParent()->hasAttr<clang::FinalAttr>(),
           .is_explicit_ctor = false,
       };
       if (auto* ctor_decl =
@@ -225,14 +473,11 @@ std::optional<IR::Item> FunctionDeclImporter::Import(
     }
   }
 
+  // Thunks for members or descendants of class templates may be generated by
+  // multiple targets. They still use the plain `mangled_name`, because they
+  // are emitted as `inline` functions that the linker deduplicates - see
+  // `thunks_for_class_template_member_functions.md`.
   std::string mangled_name = ictx_.GetMangledName(function_decl);
-  if (is_member_or_descendant_of_class_template) {
-    // `thunks_for_class_template_member_functions.md` explains in more detail
-    // why the `mangled_name` has to include the target name when working with
-    // members or descendants of a class template.
-    mangled_name += '_';
-    mangled_name += ConvertToCcIdentifier(ictx_.GetOwningTarget(function_decl));
-  }
 
   // Silence ClangTidy, checked above: calling `add_error` if
   // `!return_type.ok()` and returning early if `!errors.empty()`.
@@ -255,6 +500,7 @@ std::optional<IR::Item> FunctionDeclImporter::Import(
         .source_loc = ictx_.ConvertSourceLocation(function_decl->getBeginLoc()),
         .id = GenerateItemId(function_decl),
         .enclosing_namespace_id = GetEnclosingNamespaceId(function_decl),
+        .inline_body = ImportInlineBody(*function_decl),
     };
   }
   return std::nullopt;
@@ -14,6 +14,20 @@ class FunctionDeclImporter : public DeclImporterBase<clang::FunctionDecl> {
  public:
   FunctionDeclImporter(ImportContext& context) : DeclImporterBase(context) {}
   std::optional<IR::Item> Import(clang::FunctionDecl*);
+
+ private:
+  // Returns the body of `function_decl` as an `InlineExpr`, if the function is
+  // `inline` and its body is a single `return` of an expression that can be
+  // evaluated in Rust.
+  std::optional<InlineExpr> ImportInlineBody(
+      const clang::FunctionDecl& function_decl);
+
+  // Converts `expr` (from the body of `function_decl`) to an `InlineExpr` of
+  // type `type`, or returns `std::nullopt` if `expr` is outside of the
+  // supported subset of C++.
+  std::optional<InlineExpr> ImportInlineExpr(
+      const clang::FunctionDecl& function_decl, const clang::Expr* expr,
+      clang::QualType type);
 };
 
 }  // namespace crubit
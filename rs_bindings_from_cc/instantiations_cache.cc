@@ -0,0 +1,256 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "rs_bindings_from_cc/instantiations_cache.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/substitute.h"
+#include "absl/types/span.h"
+#include "common/file_io.h"
+#include "common/status_macros.h"
+#include "rs_bindings_from_cc/bazel_types.h"
+#include "rs_bindings_from_cc/cmdline.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "clang/Frontend/FrontendActions.h"
+#include "clang/Tooling/Tooling.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/SHA256.h"
+
+namespace crubit {
+namespace {
+
+// Bump whenever the format of the entries or the generated code changes in a
+// way that isn't reflected by the other components of the key.
+constexpr int kCacheFormatVersion = 2;
+
+// Appends a length-prefixed `value` to `key_material`, so that the boundaries
+// between the components of the key are unambiguous.
+void AppendKeyComponent(std::string& key_material, absl::string_view name,
+                        absl::string_view value) {
+  absl::SubstituteAndAppend(&key_material, "$0:$1:$2\n", name, value.size(),
+                            value);
+}
+
+std::string HexDigest(llvm::StringRef data) {
+  return llvm::toHex(llvm::SHA256::hash(llvm::arrayRefFromStringRef(data)),
+                     /*LowerCase=*/true);
+}
+
+// Preprocesses the input and records the name and the digest of the contents
+// of every file that the preprocessor reads.
+class CollectIncludedFilesAction : public clang::PreprocessOnlyAction {
+ public:
+  explicit CollectIncludedFilesAction(
+      std::map<std::string, std::string>& file_digests)
+      : file_digests_(file_digests) {}
+
+ protected:
+  void EndSourceFileAction() override {
+    clang::SourceManager& sm = getCompilerInstance().getSourceManager();
+    for (auto it = sm.fileinfo_begin(); it != sm.fileinfo_end(); ++it) {
+      auto buffer = sm.getMemoryBufferForFileOrNone(it->first);
+      file_digests_[it->first->getName().str()] =
+          buffer ? HexDigest(buffer->getBuffer()) : "unreadable";
+    }
+    clang::PreprocessOnlyAction::EndSourceFileAction();
+  }
+
+ private:
+  std::map<std::string, std::string>& file_digests_;
+};
+
+// JSON representation of a `CachedInstantiations`.
+struct Entry {
+  std::string rs_api;
+  std::string rs_api_impl;
+  std::map<std::string, std::string> instantiations;
+};
+
+bool fromJSON(const llvm::json::Value& json, Entry& out,
+              llvm::json::Path path) {
+  llvm::json::ObjectMapper mapper(json, path);
+  return mapper && mapper.map("rs_api", out.rs_api) &&
+         mapper.map("rs_api_impl", out.rs_api_impl) &&
+         mapper.map("instantiations", out.instantiations);
+}
+
+std::string EntryPath(absl::string_view cache_dir, absl::string_view key) {
+  return absl::StrCat(cache_dir, "/", key, ".json");
+}
+
+}  // namespace
+
+std::string ToolsFingerprint(absl::Span<const std::string> paths) {
+  std::string material;
+  for (const std::string& path : paths) {
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> contents =
+        llvm::MemoryBuffer::getFile(path, /*IsText=*/false,
+                                    /*RequiresNullTerminator=*/false);
+    AppendKeyComponent(material, path,
+                       contents ? HexDigest((*contents)->getBuffer())
+                                : "missing");
+  }
+  return HexDigest(material);
+}
+
+std::string GeneratorExecutablePath() {
+  static int anchor = 0;
+  return llvm::sys::fs::getMainExecutable(/*argv0=*/nullptr, &anchor);
+}
+
+absl::StatusOr<std::string> IncludedHeadersFingerprint(
+    absl::Span<const HeaderName> public_headers,
+    absl::Span<const std::string> clang_args,
+    const absl::flat_hash_map<const HeaderName, const std::string>&
+        virtual_headers_contents_for_testing) {
+  clang::tooling::FileContentMappings file_contents;
+  for (const auto& [name, content] : virtual_headers_contents_for_testing) {
+    file_contents.push_back({std::string(name.IncludePath()), content});
+  }
+  std::string input;
+  for (const HeaderName& header : public_headers) {
+    absl::SubstituteAndAppend(&input, "#include \"$0\"\n",
+                              header.IncludePath());
+  }
+  // The same language mode as in `IrFromCc`, so that the same files are
+  // included.
+  std::vector<std::string> args = {"-std=gnu++17"};
+  args.insert(args.end(), clang_args.begin(), clang_args.end());
+
+  std::map<std::string, std::string> file_digests;
+  if (!clang::tooling::runToolOnCodeWithArgs(
+          std::make_unique<CollectIncludedFilesAction>(file_digests), input,
+          args, "instantiations_cache_input.cc", "rs_bindings_from_cc",
+          std::make_shared<clang::PCHContainerOperations>(), file_contents)) {
+    return absl::InvalidArgumentError(
+        "Could not preprocess the public headers");
+  }
+  std::string material;
+  for (const auto& [name, digest] : file_digests) {
+    AppendKeyComponent(material, name, digest);
+  }
+  return HexDigest(material);
+}
+
+std::string InstantiationsCacheKey(
+    const Cmdline& cmdline, absl::Span<const std::string> clang_args,
+    absl::Span<const std::string> requested_instantiations,
+    absl::string_view tools_fingerprint,
+    absl::string_view headers_fingerprint) {
+  std::string key_material;
+  AppendKeyComponent(key_material, "version",
+                     absl::StrCat(kCacheFormatVersion));
+  AppendKeyComponent(key_material, "tools", tools_fingerprint);
+  AppendKeyComponent(key_material, "headers", headers_fingerprint);
+
+  std::vector<std::string> instantiations(requested_instantiations.begin(),
+                                          requested_instantiations.end());
+  std::sort(instantiations.begin(), instantiations.end());
+  instantiations.erase(
+      std::unique(instantiations.begin(), instantiations.end()),
+      instantiations.end());
+  for (const std::string& instantiation : instantiations) {
+    AppendKeyComponent(key_material, "instantiation", instantiation);
+  }
+
+  for (const std::string& clang_arg : clang_args) {
+    AppendKeyComponent(key_material, "clang_arg", clang_arg);
+  }
+  // The order of the public headers matters, because it is the order of the
+  // `#include`s in the generated C++ code.
+  for (const HeaderName& header : cmdline.public_headers()) {
+    AppendKeyComponent(key_material, "public_header", header.IncludePath());
+  }
+  std::vector<std::pair<absl::string_view, absl::string_view>>
+      headers_to_targets;
+  for (const auto& [header, target] : cmdline.headers_to_targets()) {
+    // Only the ownership by the current target matters, not its label.
+    absl::string_view owner = target == cmdline.current_target()
+                                  ? absl::string_view()
+                                  : absl::string_view(target.value());
+    headers_to_targets.push_back({header.IncludePath(), owner});
+  }
+  std::sort(headers_to_targets.begin(), headers_to_targets.end());
+  for (const auto& [header, owner] : headers_to_targets) {
+    AppendKeyComponent(key_material, "header", header);
+    AppendKeyComponent(key_material, "owner", owner);
+  }
+  for (const std::string& extra_rs_src : cmdline.extra_rs_srcs()) {
+    AppendKeyComponent(key_material, "extra_rs_src", extra_rs_src);
+  }
+
+  AppendKeyComponent(key_material, "crubit_support_path",
+                     cmdline.crubit_support_path());
+  AppendKeyComponent(key_material, "clang_format_exe_path",
+                     cmdline.clang_format_exe_path());
+  AppendKeyComponent(key_material, "rustfmt_exe_path",
+                     cmdline.rustfmt_exe_path());
+  AppendKeyComponent(key_material, "rustfmt_config_path",
+                     cmdline.rustfmt_config_path());
+  AppendKeyComponent(key_material, "compact_layout_assertions",
+                     cmdline.compact_layout_assertions() ? "1" : "0");
+
+  return HexDigest(key_material);
+}
+
+absl::StatusOr<std::optional<CachedInstantiations>> LookUpInstantiationsCache(
+    absl::string_view cache_dir, absl::string_view key) {
+  std::string path = EntryPath(cache_dir, key);
+  if (!llvm::sys::fs::exists(path)) {
+    return std::nullopt;
+  }
+  CRUBIT_ASSIGN_OR_RETURN(std::string contents, GetFileContents(path));
+  auto entry = llvm::json::parse<Entry>(contents);
+  if (auto err = entry.takeError()) {
+    return absl::InternalError(
+        absl::StrCat("Malformed instantiations cache entry '", path,
+                     "': ", llvm::toString(std::move(err))));
+  }
+  return CachedInstantiations{
+      .rs_api = std::move(entry->rs_api),
+      .rs_api_impl = std::move(entry->rs_api_impl),
+      .instantiations = {entry->instantiations.begin(),
+                         entry->instantiations.end()},
+  };
+}
+
+absl::Status StoreInInstantiationsCache(absl::string_view cache_dir,
+                                        absl::string_view key,
+                                        const CachedInstantiations& entry) {
+  if (std::error_code error_code =
+          llvm::sys::fs::create_directories(std::string(cache_dir))) {
+    return absl::InternalError(error_code.message());
+  }
+  llvm::json::Object instantiations;
+  for (const auto& [cc_name, rs_name] : entry.instantiations) {
+    instantiations[cc_name] = rs_name;
+  }
+  llvm::json::Value json = llvm::json::Object{
+      {"rs_api", entry.rs_api},
+      {"rs_api_impl", entry.rs_api_impl},
+      {"instantiations", std::move(instantiations)},
+  };
+  return SetFileContents(EntryPath(cache_dir, key),
+                         std::string(llvm::formatv("{0}", json)));
+}
+
+}  // namespace crubit
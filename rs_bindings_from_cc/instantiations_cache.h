@@ -0,0 +1,108 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_INSTANTIATIONS_CACHE_H_
+#define THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_INSTANTIATIONS_CACHE_H_
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "rs_bindings_from_cc/bazel_types.h"
+#include "rs_bindings_from_cc/cmdline.h"
+
+namespace crubit {
+
+// An opt-in store (see `--instantiations_cache_dir`) of the outputs of whole
+// runs of the template instantiation mode.
+//
+// The bindings for a set of `cc_template!` instantiations don't depend on the
+// crate that requested them, so a run that requests exactly the same set of
+// instantiations as an earlier one (with the same toolchain and headers) can
+// reuse its outputs instead of importing the headers and generating bindings
+// again.
+//
+// Entries are keyed by the whole set of requested instantiations, not by the
+// individual instantiations: crates that request `{std::vector<int>}` and
+// `{std::vector<int>, std::vector<float>}` share nothing, and each of them
+// still generates (and compiles) its own bindings for `std::vector<int>`.
+// Computing the key is not free either: every run preprocesses all the public
+// headers and hashes the generator and formatter binaries before it can look
+// up an entry. The store therefore only pays off when the same sets of
+// instantiations are requested over and over.
+//
+// Each entry is a single JSON file named after its key. Entries are written
+// atomically, so concurrent generators can share the store; entries are never
+// evicted.
+//
+// The store lives outside of the build graph, so it must not be used from
+// Bazel actions (the Bazel rules never pass `--instantiations_cache_dir`, so
+// no build in this repository uses it): Bazel wouldn't know about the files
+// read from it. It is meant for running the generator directly, e.g. from
+// scripts or other build systems.
+
+// The outputs of the template instantiation mode.
+struct CachedInstantiations {
+  // Generated Rust source code.
+  std::string rs_api;
+  // Generated C++ source code.
+  std::string rs_api_impl;
+  // Requested instantiations and their Rust struct names.
+  absl::flat_hash_map<std::string, std::string> instantiations;
+};
+
+// Returns a digest of the contents of the files at `paths`, which identifies
+// the version of the tools that produce the bindings (the generator itself and
+// the formatters) and of their configuration. Files that don't exist are
+// recorded as missing.
+std::string ToolsFingerprint(absl::Span<const std::string> paths);
+
+// Returns the path of the running generator binary.
+std::string GeneratorExecutablePath();
+
+// Returns a digest of the names and contents of all the files transitively
+// included by `public_headers` when preprocessed with the given `clang_args`.
+// Those are the files that define the instantiated templates, including the
+// toolchain headers (e.g. the C++ standard library).
+absl::StatusOr<std::string> IncludedHeadersFingerprint(
+    absl::Span<const HeaderName> public_headers,
+    absl::Span<const std::string> clang_args,
+    const absl::flat_hash_map<const HeaderName, const std::string>&
+        virtual_headers_contents_for_testing);
+
+// Returns the key of the bindings for `requested_instantiations` (as returned
+// by `CollectInstantiations`) generated according to `cmdline` with the given
+// `clang_args`, by the tools identified by `tools_fingerprint` (see
+// `ToolsFingerprint`), from the headers identified by `headers_fingerprint`
+// (see `IncludedHeadersFingerprint`).
+//
+// The key covers the instantiations (in a canonical order) and everything that
+// identifies the toolchain and the generated code: the Clang arguments, the
+// public headers and the targets that own them, the contents of all the
+// included headers, the code generation and formatting options, and the tools.
+// The label of the current target is deliberately left out, which is what
+// makes entries reusable across crates.
+std::string InstantiationsCacheKey(
+    const Cmdline& cmdline, absl::Span<const std::string> clang_args,
+    absl::Span<const std::string> requested_instantiations,
+    absl::string_view tools_fingerprint, absl::string_view headers_fingerprint);
+
+// Returns the entry stored under `key` in `cache_dir`, or `std::nullopt` if
+// there is no such entry.
+absl::StatusOr<std::optional<CachedInstantiations>> LookUpInstantiationsCache(
+    absl::string_view cache_dir, absl::string_view key);
+
+// Stores `entry` under `key` in `cache_dir`, creating the directory if needed.
+absl::Status StoreInInstantiationsCache(absl::string_view cache_dir,
+                                        absl::string_view key,
+                                        const CachedInstantiations& entry);
+
+}  // namespace crubit
+
+#endif  // THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_INSTANTIATIONS_CACHE_H_
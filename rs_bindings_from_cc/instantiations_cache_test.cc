@@ -0,0 +1,171 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "rs_bindings_from_cc/instantiations_cache.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/log/check.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "common/status_test_matchers.h"
+#include "common/test_utils.h"
+#include "rs_bindings_from_cc/bazel_types.h"
+#include "rs_bindings_from_cc/cmdline.h"
+
+namespace crubit {
+namespace {
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Pair;
+using ::testing::UnorderedElementsAre;
+
+Cmdline TestCmdline(std::string target, std::string rustfmt_config_path) {
+  std::string targets_and_headers =
+      absl::StrCat(R"([{"t": ")", target,
+                   R"(", "h": ["a.h"]}, {"t": "//:dep", "h": ["b.h"]}])");
+  absl::StatusOr<Cmdline> cmdline = Cmdline::CreateForTesting(
+      std::move(target), "cc_out", "rs_out", /* ir_out= */ "",
+      /* namespaces_out= */ "", "crubit_support_path", "clang_format_exe_path",
+      "rustfmt_exe_path", std::move(rustfmt_config_path),
+      /* do_nothing= */ false, {"a.h"}, std::move(targets_and_headers),
+      /* extra_rs_srcs= */ {}, {"lib.rs"}, "instantiations_out",
+      /* error_report_out= */ "",
+      /* shard_rs_out= */ false, /* profile_out= */ "",
+      /* compact_layout_assertions= */ false, "instantiations_cache");
+  CHECK(cmdline.ok()) << cmdline.status();
+  return *std::move(cmdline);
+}
+
+// Returns the key for the given inputs, built by the same tools from the same
+// headers.
+std::string Key(const Cmdline& cmdline,
+                absl::Span<const std::string> clang_args,
+                absl::Span<const std::string> requested_instantiations) {
+  return InstantiationsCacheKey(cmdline, clang_args, requested_instantiations,
+                                "tools", "headers");
+}
+
+TEST(InstantiationsCacheTest, KeyDoesNotDependOnCurrentTarget) {
+  std::vector<std::string> clang_args = {"-I", "include"};
+  EXPECT_THAT(Key(TestCmdline("//:target1", "rustfmt.toml"), clang_args,
+                  {"std :: vector < int >"}),
+              Eq(Key(TestCmdline("//:target2", "rustfmt.toml"), clang_args,
+                     {"std :: vector < int >"})));
+}
+
+TEST(InstantiationsCacheTest, KeyDoesNotDependOnOrderOfInstantiations) {
+  Cmdline cmdline = TestCmdline("//:target", "rustfmt.toml");
+  EXPECT_THAT(
+      Key(cmdline, {}, {"A < int >", "B < int >"}),
+      Eq(Key(cmdline, {}, {"B < int >", "A < int >", "B < int >"})));
+}
+
+TEST(InstantiationsCacheTest, KeyDependsOnInstantiations) {
+  Cmdline cmdline = TestCmdline("//:target", "rustfmt.toml");
+  EXPECT_THAT(Key(cmdline, {}, {"A < int >"}),
+              Ne(Key(cmdline, {}, {"A < long >"})));
+  EXPECT_THAT(Key(cmdline, {}, {"A < int >"}),
+              Ne(Key(cmdline, {}, {"A < int >", "B < int >"})));
+}
+
+TEST(InstantiationsCacheTest, KeyDependsOnToolchain) {
+  Cmdline cmdline = TestCmdline("//:target", "rustfmt.toml");
+  EXPECT_THAT(Key(cmdline, {"-DFOO=1"}, {"A < int >"}),
+              Ne(Key(cmdline, {"-DFOO=2"}, {"A < int >"})));
+  // Boundaries between the arguments matter.
+  EXPECT_THAT(Key(cmdline, {"-I", "x"}, {"A < int >"}),
+              Ne(Key(cmdline, {"-Ix"}, {"A < int >"})));
+  EXPECT_THAT(Key(cmdline, {}, {"A < int >"}),
+              Ne(Key(TestCmdline("//:target", "other_rustfmt.toml"), {},
+                     {"A < int >"})));
+}
+
+TEST(InstantiationsCacheTest, KeyDependsOnToolsAndHeaders) {
+  Cmdline cmdline = TestCmdline("//:target", "rustfmt.toml");
+  std::string key = InstantiationsCacheKey(cmdline, {}, {"A < int >"},
+                                           "tools1", "headers1");
+  EXPECT_THAT(key, Ne(InstantiationsCacheKey(cmdline, {}, {"A < int >"},
+                                             "tools2", "headers1")));
+  EXPECT_THAT(key, Ne(InstantiationsCacheKey(cmdline, {}, {"A < int >"},
+                                             "tools1", "headers2")));
+}
+
+TEST(InstantiationsCacheTest, ToolsFingerprintDependsOnContents) {
+  std::string tool = WriteFileForCurrentTest("tool", "version 1");
+  std::string missing_tool = absl::StrCat(testing::TempDir(), "/missing_tool");
+  std::string fingerprint = ToolsFingerprint({tool, missing_tool});
+  EXPECT_THAT(ToolsFingerprint({tool, missing_tool}), Eq(fingerprint));
+
+  WriteFileForCurrentTest("tool", "version 2");
+  EXPECT_THAT(ToolsFingerprint({tool, missing_tool}), Ne(fingerprint));
+}
+
+TEST(InstantiationsCacheTest, HeadersFingerprintDependsOnIncludedHeaders) {
+  auto fingerprint = [](std::string b_h_content) {
+    absl::StatusOr<std::string> result = IncludedHeadersFingerprint(
+        {HeaderName("a.h")}, {},
+        {{HeaderName("a.h"), "#include \"b.h\"\n"},
+         {HeaderName("b.h"), std::move(b_h_content)}});
+    CHECK(result.ok()) << result.status();
+    return *std::move(result);
+  };
+  std::string original = fingerprint("template <typename T> struct A {};");
+  EXPECT_THAT(fingerprint("template <typename T> struct A {};"),
+              Eq(original));
+  // A change in a transitively included header changes the fingerprint.
+  EXPECT_THAT(fingerprint("template <typename T> struct A { T t; };"),
+              Ne(original));
+}
+
+TEST(InstantiationsCacheTest, HeadersFingerprintIgnoresUnusedHeaders) {
+  auto fingerprint = [](std::string unused_h_content) {
+    absl::StatusOr<std::string> result = IncludedHeadersFingerprint(
+        {HeaderName("a.h")}, {},
+        {{HeaderName("a.h"), "struct A {};"},
+         {HeaderName("unused.h"), std::move(unused_h_content)}});
+    CHECK(result.ok()) << result.status();
+    return *std::move(result);
+  };
+  EXPECT_THAT(fingerprint("struct Unused {};"),
+              Eq(fingerprint("struct Unused { int i; };")));
+}
+
+TEST(InstantiationsCacheTest, LookUpMissingEntry) {
+  std::string cache_dir = absl::StrCat(testing::TempDir(), "/missing_entry");
+  EXPECT_THAT(LookUpInstantiationsCache(cache_dir, "0123"),
+              IsOkAndHolds(Eq(std::nullopt)));
+}
+
+TEST(InstantiationsCacheTest, StoreAndLookUp) {
+  std::string cache_dir =
+      absl::StrCat(testing::TempDir(), "/store_and_look_up");
+  ASSERT_OK(StoreInInstantiationsCache(
+      cache_dir, "0123",
+      CachedInstantiations{
+          .rs_api = "// rs_api",
+          .rs_api_impl = "// rs_api_impl",
+          .instantiations = {{"A < int >", "__CcTemplateInst1AIiE"}},
+      }));
+
+  ASSERT_OK_AND_ASSIGN(std::optional<CachedInstantiations> entry,
+                       LookUpInstantiationsCache(cache_dir, "0123"));
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(entry->rs_api, "// rs_api");
+  EXPECT_EQ(entry->rs_api_impl, "// rs_api_impl");
+  EXPECT_THAT(entry->instantiations,
+              UnorderedElementsAre(Pair("A < int >", "__CcTemplateInst1AIiE")));
+  EXPECT_THAT(LookUpInstantiationsCache(cache_dir, "4567"),
+              IsOkAndHolds(Eq(std::nullopt)));
+}
+
+}  // namespace
+}  // namespace crubit
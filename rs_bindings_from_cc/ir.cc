@@ -136,6 +136,16 @@ MappedType MappedType::RValueReferenceTo(MappedType pointee_type,
                               /*nullable=*/false);
 }
 
+MappedType MappedType::SliceOf(MappedType element_type, std::string cc_name) {
+  absl::string_view rs_name = element_type.cc_type.is_const
+                                  ? internal::kRustSliceConst
+                                  : internal::kRustSliceMut;
+  MappedType slice_type =
+      MappedType::Simple(std::string(rs_name), std::move(cc_name));
+  slice_type.rs_type.type_args.push_back(std::move(element_type.rs_type));
+  return slice_type;
+}
+
 MappedType MappedType::FuncPtr(absl::string_view cc_call_conv,
                                absl::string_view rs_abi,
                                std::optional<LifetimeId> lifetime,
@@ -275,6 +285,7 @@ llvm::json::Value MemberFuncMetadata::InstanceMethodMetadata::ToJson() const {
       {"reference", reference_str},
       {"is_const", is_const},
       {"is_virtual", is_virtual},
+      {"is_final", is_final},
       {"is_explicit_ctor", is_explicit_ctor},
   };
 }
@@ -298,6 +309,50 @@ llvm::json::Value UseMod::ToJson() const {
   };
 }
 
+llvm::json::Value InlineExpr::ToJson() const {
+  switch (kind) {
+    case kParam:
+      return llvm::json::Object{{"Param", param_index}};
+    case kField:
+      return llvm::json::Object{
+          {"Field",
+           llvm::json::Object{
+               {"identifier", *field},
+               {"type", *type},
+           }},
+      };
+    case kIntegerLiteral:
+      return llvm::json::Object{
+          {"IntegerLiteral",
+           llvm::json::Object{
+               {"value", *integer_literal},
+               {"type", *type},
+           }},
+      };
+    case kBoolLiteral:
+      return llvm::json::Object{{"BoolLiteral", bool_literal}};
+    case kUnaryOp:
+      return llvm::json::Object{
+          {"UnaryOp",
+           llvm::json::Object{
+               {"op", op},
+               {"is_integral", is_integral},
+               {"operand", operands[0]},
+           }},
+      };
+    case kBinaryOp:
+      return llvm::json::Object{
+          {"BinaryOp",
+           llvm::json::Object{
+               {"op", op},
+               {"is_integral", is_integral},
+               {"lhs", operands[0]},
+               {"rhs", operands[1]},
+           }},
+      };
+  }
+}
+
 llvm::json::Value Func::ToJson() const {
   llvm::json::Object func{
       {"name", name},
@@ -316,6 +371,7 @@ llvm::json::Value Func::ToJson() const {
       {"id", id},
       {"enclosing_namespace_id", enclosing_namespace_id},
       {"adl_enclosing_record", adl_enclosing_record},
+      {"inline_body", inline_body},
   };
 
   return llvm::json::Object{
@@ -434,6 +490,7 @@ llvm::json::Value Record::ToJson() const {
       {"record_type", RecordTypeToString(record_type)},
       {"is_aggregate", is_aggregate},
       {"is_anon_record_with_typedef", is_anon_record_with_typedef},
+      {"has_bulk_thunks", has_bulk_thunks},
       {"child_item_ids", std::move(json_item_ids)},
       {"enclosing_namespace_id", enclosing_namespace_id},
   };
@@ -53,6 +53,10 @@ inline constexpr absl::string_view kRustRvalueRefConst =
 // Function pointers.
 inline constexpr absl::string_view kRustFuncPtr = "#funcPtr";
 
+// Contiguous views (e.g. `absl::Span<T>`).
+inline constexpr absl::string_view kRustSliceMut = "#Slice mut";
+inline constexpr absl::string_view kRustSliceConst = "#Slice const";
+
 // C++ types therein.
 inline constexpr absl::string_view kCcPtr = "*";
 inline constexpr absl::string_view kCcLValueRef = "&";
@@ -196,6 +200,8 @@ struct RsType {
   //   `type_args`; param types are stored in other `type_args`; <abi> would be
   //   replaced with "cdecl", "stdcall" or other Abi - see
   //   https://doc.rust-lang.org/reference/types/function-pointer.html);
+  // - "#Slice const", "#Slice mut" (a pointer and a length, like
+  //   `absl::Span<T>`; the element type is stored in `type_args[0]`);
   // - An empty string when `decl_id` is non-empty.
   std::string name;
 
@@ -270,6 +276,10 @@ struct MappedType {
                             MappedType return_type,
                             std::vector<MappedType> param_types);
 
+  // Creates a mapped type for a contiguous view of `element_type`s (e.g.
+  // `absl::Span<const int>`), spelled as `cc_name` in C++.
+  static MappedType SliceOf(MappedType element_type, std::string cc_name);
+
   bool IsVoid() const { return rs_type.name == "()"; }
 
   llvm::json::Value ToJson() const;
@@ -414,6 +424,10 @@ struct MemberFuncMetadata {
     bool is_const = false;
     bool is_virtual = false;
 
+    // If the member function can't be overridden any further, because either
+    // the function or its class is declared `final`.
+    bool is_final = false;
+
     // If the member function was a constructor with an `explicit` specifier.
     bool is_explicit_ctor = false;
   };
@@ -429,6 +443,43 @@ struct MemberFuncMetadata {
   std::optional<InstanceMethodMetadata> instance_method_metadata;
 };
 
+// An expression from the body of a trivial inline function.
+//
+// Only a small subset of C++ is represented: reads of parameters and of fields
+// of `*this`, integer and `bool` literals, and built-in operators whose
+// operands all have the same primitive type. Such expressions mean the same
+// thing in Rust (modulo wrapping of integer arithmetic, which is spelled out
+// explicitly in Rust), so the bindings can evaluate them directly instead of
+// calling the function through a C++ thunk.
+struct InlineExpr {
+  llvm::json::Value ToJson() const;
+
+  enum Kind : char {
+    kParam,           // `params[param_index]` of the enclosing `Func`.
+    kField,           // `this->field`.
+    kIntegerLiteral,  // `integer_literal`.
+    kBoolLiteral,     // `bool_literal`.
+    kUnaryOp,         // `op operands[0]`.
+    kBinaryOp,        // `operands[0] op operands[1]`.
+  };
+
+  Kind kind;
+  int param_index = 0;
+  std::optional<Identifier> field;
+  std::optional<IntegerConstant> integer_literal;
+  bool bool_literal = false;
+  // The type of a field or of an integer literal. (Private fields are opaque
+  // blobs of bytes in the generated Rust struct, so the bindings need the type
+  // to read them.)
+  std::optional<MappedType> type;
+  // The C++ spelling of the operator, e.g. `+` or `<=`.
+  std::string op;
+  // True if the operands of `op` are integers (rather than `bool`s or floating
+  // point numbers).
+  bool is_integral = false;
+  std::vector<InlineExpr> operands;
+};
+
 // A function involved in the bindings.
 struct Func {
   llvm::json::Value ToJson() const;
@@ -455,6 +506,9 @@ struct Func {
   // Rust type modeling in src_code_gen makes it much easier to do on the
   // consuming end.
   std::optional<ItemId> adl_enclosing_record;
+  // If present, the function is `inline` and its body is a single `return` of
+  // this expression, which the bindings can evaluate in Rust.
+  std::optional<InlineExpr> inline_body;
 };
 
 inline std::ostream& operator<<(std::ostream& o, const Func& f) {
@@ -627,6 +681,11 @@ struct Record {
   // It is an anoymous record with a typedef name.
   bool is_anon_record_with_typedef = false;
 
+  // Whether the record is annotated with
+  // `[[clang::annotate("crubit_bulk_thunks")]]`, which requests thunks that
+  // construct, move, or destroy a whole array of objects in a single call.
+  bool has_bulk_thunks = false;
+
   // True when this record is created from an explicit class template
   // instantiation definition (which is also what cc_template!{} macro results
   // in).
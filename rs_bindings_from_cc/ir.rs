@@ -274,6 +274,10 @@ pub struct InstanceMethodMetadata {
     pub is_const: bool,
     pub is_virtual: bool,
 
+    /// If the member function can't be overridden any further, because either
+    /// the function or its class is declared `final`.
+    pub is_final: bool,
+
     /// If the member function was a constructor with an `explicit` specifier.
     pub is_explicit_ctor: bool,
 }
@@ -291,6 +295,37 @@ pub struct FuncParam {
     pub identifier: Identifier,
 }
 
+/// An expression from the body of a trivial inline function, which can be
+/// evaluated in Rust instead of calling the function through a C++ thunk.
+#[derive(Debug, PartialEq, Eq, Hash, Clone, Deserialize)]
+pub enum InlineExpr {
+    /// The parameter with the given index in `Func::params`.
+    Param(usize),
+    /// A field of `*this`.
+    Field {
+        identifier: Identifier,
+        #[serde(rename(deserialize = "type"))]
+        type_: MappedType,
+    },
+    IntegerLiteral {
+        value: IntegerConstant,
+        #[serde(rename(deserialize = "type"))]
+        type_: MappedType,
+    },
+    BoolLiteral(bool),
+    UnaryOp {
+        op: Rc<str>,
+        is_integral: bool,
+        operand: Box<InlineExpr>,
+    },
+    BinaryOp {
+        op: Rc<str>,
+        is_integral: bool,
+        lhs: Box<InlineExpr>,
+        rhs: Box<InlineExpr>,
+    },
+}
+
 #[derive(Debug, PartialEq, Eq, Hash, Clone, Deserialize)]
 pub struct Func {
     pub name: UnqualifiedIdentifier,
@@ -313,6 +348,7 @@ pub struct Func {
     pub id: ItemId,
     pub enclosing_namespace_id: Option<ItemId>,
     pub adl_enclosing_record: Option<ItemId>,
+    pub inline_body: Option<InlineExpr>,
 }
 
 impl Func {
@@ -415,6 +451,7 @@ pub struct Record {
     pub record_type: RecordType,
     pub is_aggregate: bool,
     pub is_anon_record_with_typedef: bool,
+    pub has_bulk_thunks: bool,
     pub child_item_ids: Vec<ItemId>,
     pub enclosing_namespace_id: Option<ItemId>,
 }
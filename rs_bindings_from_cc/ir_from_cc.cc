@@ -22,6 +22,7 @@
 #include "rs_bindings_from_cc/ir.h"
 #include "clang/Frontend/FrontendAction.h"
 #include "clang/Tooling/Tooling.h"
+#include "llvm/Support/TimeProfiler.h"
 
 namespace crubit {
 
@@ -40,6 +41,7 @@ absl::StatusOr<IR> IrFromCc(
     absl::Span<const std::string> extra_rs_srcs,
     absl::Span<const absl::string_view> clang_args,
     absl::Span<const std::string> extra_instantiations) {
+  llvm::TimeTraceScope time_trace("IrFromCc");
   // Caller should verify that the inputs are not empty.
   CHECK(!extra_source_code_for_testing.empty() || !public_headers.empty() ||
         !extra_instantiations.empty());
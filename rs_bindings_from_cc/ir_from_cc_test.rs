@@ -82,6 +82,7 @@ fn test_function() {
                 id: ItemId(...),
                 enclosing_namespace_id: None,
                 adl_enclosing_record: None,
+                inline_body: None,
             }
         }
     );
@@ -124,6 +125,99 @@ fn test_function_with_custom_calling_convention() {
     );
 }
 
+#[test]
+fn test_function_inline_body() -> Result<()> {
+    let ir = ir_from_cc(
+        r#"
+        inline int Add(int a, int b) { return a + b; }
+        constexpr bool IsPositive(long x) { return x > 0; }
+        struct SomeStruct {
+          long Offset(long delta) const { return field + delta; }
+          long field;
+        };"#,
+    )?;
+    assert_ir_matches!(
+        ir,
+        quote! {
+            Func {
+                name: "Add", ...
+                inline_body: Some(BinaryOp {
+                    op: "+",
+                    is_integral: true,
+                    lhs: Param(0),
+                    rhs: Param(1),
+                }),
+            }
+        }
+    );
+    assert_ir_matches!(
+        ir,
+        quote! {
+            Func {
+                name: "IsPositive", ...
+                inline_body: Some(BinaryOp {
+                    op: ">",
+                    is_integral: true,
+                    lhs: Param(0),
+                    rhs: IntegerLiteral {
+                        value: IntegerConstant { is_negative: false, wrapped_value: 0, },
+                        type_: MappedType { rs_type: RsType { name: Some("i64"), ... }, ... },
+                    },
+                }),
+            }
+        }
+    );
+    // `Func::params` starts with `__this`.
+    assert_ir_matches!(
+        ir,
+        quote! {
+            Func {
+                name: "Offset", ...
+                inline_body: Some(BinaryOp {
+                    op: "+",
+                    is_integral: true,
+                    lhs: Field { identifier: "field", ... },
+                    rhs: Param(1),
+                }),
+            }
+        }
+    );
+    Ok(())
+}
+
+#[test]
+fn test_function_inline_body_unsupported() -> Result<()> {
+    let ir = ir_from_cc(
+        r#"
+        int NotInline(int a);
+        inline int NoBody(int a);
+        inline int TwoStatements(int a) { int b = a; return b; }
+        inline int ByReference(const int& a) { return a; }
+        inline short Promoted(short a) { return a + 1; }
+        inline int IntegerDivision(int a, int b) { return a / b; }
+        inline int Call(int a) { return NotInline(a); }
+        struct Base { int base_field; };
+        struct Derived : Base {
+          int GetBaseField() const { return base_field; }
+          virtual int Virtual() const { return 42; }
+        };"#,
+    )?;
+    for name in [
+        "NotInline",
+        "NoBody",
+        "TwoStatements",
+        "ByReference",
+        "Promoted",
+        "IntegerDivision",
+        "Call",
+        "GetBaseField",
+        "Virtual",
+    ] {
+        assert_ir_matches!(ir, quote! { Func { name: #name, ... inline_body: None, } });
+    }
+    Ok(())
+}
+
 #[test]
 fn test_functions_from_dependency_are_not_emitted() -> Result<()> {
     let ir = ir_from_cc_dependency("int Add(int a, int b);", "int Multiply(int a, int b);")?;
@@ -960,7 +1054,7 @@ fn test_typedef_of_full_template_specialization() -> Result<()> {
           Func {
             name: "GetValue",
             owning_target: BazelLabel("//test:testing_target"),
-            mangled_name: "_ZNK23test_namespace_bindings8MyStructIiE8GetValueEv__2f_2ftest_3atesting_5ftarget", ...
+            mangled_name: "_ZNK23test_namespace_bindings8MyStructIiE8GetValueEv", ...
             doc_comment: Some("Doc comment of GetValue method."), ...
             is_inline: true, ...
             member_func_metadata: Some(MemberFuncMetadata {
@@ -980,7 +1074,7 @@ fn test_typedef_of_full_template_specialization() -> Result<()> {
           Func {
               name: "operator=",
               owning_target: BazelLabel("//test:testing_target"),
-              mangled_name: "_ZN23test_namespace_bindings8MyStructIiEaSERKS1___2f_2ftest_3atesting_5ftarget", ...
+              mangled_name: "_ZN23test_namespace_bindings8MyStructIiEaSERKS1_", ...
               doc_comment: None, ...
           }
         }
@@ -1049,7 +1143,7 @@ fn test_typedef_for_explicit_template_specialization() -> Result<()> {
           Func {
             name: "GetValue",
             owning_target: BazelLabel("//test:testing_target"),
-            mangled_name: "_ZNK23test_namespace_bindings8MyStructIiE8GetValueEv__2f_2ftest_3atesting_5ftarget", ...
+            mangled_name: "_ZNK23test_namespace_bindings8MyStructIiE8GetValueEv", ...
             doc_comment: Some("Doc comment of the GetValue method specialization for T=int."), ...
             is_inline: true, ...
             member_func_metadata: Some(MemberFuncMetadata {
@@ -1146,11 +1240,11 @@ fn test_implicit_specialization_items_are_deterministically_ordered() -> Result<
         .collect_vec();
     assert_eq!(
         vec![
-            "_ZN8MyStructI3StrE8MyMethodEv__2f_2ftest_3atesting_5ftarget",
-            "_ZN8MyStructIS_IiEE8MyMethodEv__2f_2ftest_3atesting_5ftarget",
-            "_ZN8MyStructIbE8MyMethodEv__2f_2ftest_3atesting_5ftarget",
-            "_ZN8MyStructIiE8MyMethodEv__2f_2ftest_3atesting_5ftarget",
-            "_ZN8MyStructIxE8MyMethodEv__2f_2ftest_3atesting_5ftarget"
+            "_ZN8MyStructI3StrE8MyMethodEv",
+            "_ZN8MyStructIS_IiEE8MyMethodEv",
+            "_ZN8MyStructIbE8MyMethodEv",
+            "_ZN8MyStructIiE8MyMethodEv",
+            "_ZN8MyStructIxE8MyMethodEv"
         ],
         method_mangled_names
     );
@@ -1296,7 +1390,7 @@ fn test_subst_template_type_parm_pack_type() -> Result<()> {
         quote! {
             Func {
                 name: "GetSum", ...
-                mangled_name: "_ZN8MyStructIJiiEE6GetSumEii__2f_2ftest_3atesting_5ftarget", ...
+                mangled_name: "_ZN8MyStructIJiiEE6GetSumEii", ...
                 params: [
                     FuncParam {
                         type_: MappedType {
@@ -1373,6 +1467,114 @@ fn test_fully_instantiated_template_in_function_return_type() -> Result<()> {
     Ok(())
 }
 
+#[test]
+fn test_contiguous_views_are_mapped_to_slices() -> Result<()> {
+    let ir = ir_from_cc(
+        r#" namespace absl {
+            template <typename T>
+            class Span { T* ptr_; decltype(sizeof(0)) len_; };
+            }  // namespace absl
+
+            namespace std {
+            inline constexpr decltype(sizeof(0)) dynamic_extent = -1;
+            template <typename T, decltype(sizeof(0)) Extent = dynamic_extent>
+            class span { T* ptr_; decltype(sizeof(0)) len_; };
+            }  // namespace std
+
+            void AbslSpan(absl::Span<const float> values);
+            void StdSpan(std::span<int> values);
+            void StaticStdSpan(std::span<int, 4> values); "#,
+    )?;
+    assert_ir_matches!(
+        ir,
+        quote! {
+            FuncParam {
+                type_: MappedType {
+                    rs_type: RsType {
+                        name: Some("#Slice const"),
+                        lifetime_args: [],
+                        type_args: [RsType {
+                            name: Some("f32"),
+                            lifetime_args: [],
+                            type_args: [],
+                            decl_id: None,
+                        }],
+                        decl_id: None,
+                    },
+                    cc_type: CcType {
+                        name: Some("absl::Span<const float>"),
+                        is_const: false,
+                        type_args: [],
+                        decl_id: None,
+                    },
+                },
+                identifier: "values",
+            }
+        }
+    );
+    assert_ir_matches!(
+        ir,
+        quote! {
+            FuncParam {
+                type_: MappedType {
+                    rs_type: RsType {
+                        name: Some("#Slice mut"),
+                        lifetime_args: [],
+                        type_args: [RsType {
+                            name: Some("i32"),
+                            lifetime_args: [],
+                            type_args: [],
+                            decl_id: None,
+                        }],
+                        decl_id: None,
+                    },
+                    cc_type: CcType {
+                        name: Some("std::span<int>"), ...
+                    },
+                },
+                identifier: "values",
+            }
+        }
+    );
+    // Spans with a static extent don't store their size, so they are imported
+    // as ordinary class template instantiations.
+    assert_ir_matches!(
+        ir,
+        quote! {
+          Record {
+            rs_name: "__CcTemplateInstSt4spanIiLm4EE", ...
+          }
+        }
+    );
+    assert_ir_not_matches!(
+        ir,
+        quote! { Record { rs_name: "__CcTemplateInstN4absl4SpanIKfEE" ... } }
+    );
+    Ok(())
+}
+
+#[test]
+fn test_record_with_bulk_thunks_annotation() -> Result<()> {
+    let ir = ir_from_cc(
+        r#" struct [[clang::annotate("crubit_bulk_thunks")]] Annotated {};
+            struct [[clang::annotate("something_else")]] OtherAnnotation {};
+            struct NotAnnotated {}; "#,
+    )?;
+    assert_ir_matches!(
+        ir,
+        quote! { Record { rs_name: "Annotated", ... has_bulk_thunks: true, ... } }
+    );
+    assert_ir_matches!(
+        ir,
+        quote! { Record { rs_name: "OtherAnnotation", ... has_bulk_thunks: false, ... } }
+    );
+    assert_ir_matches!(
+        ir,
+        quote! { Record { rs_name: "NotAnnotated", ... has_bulk_thunks: false, ... } }
+    );
+    Ok(())
+}
+
 #[test]
 fn test_fully_instantiated_template_in_function_param_type() -> Result<()> {
     let ir = ir_from_cc(
@@ -2555,6 +2757,7 @@ fn test_member_function() {
             reference: ir::ReferenceQualification::Unqualified,
             is_const: false,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: false,
         }),
     );
@@ -2569,6 +2772,7 @@ fn test_member_function_const() {
             reference: ir::ReferenceQualification::Unqualified,
             is_const: true,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: false,
         }),
     );
@@ -2583,6 +2787,39 @@ fn test_member_function_virtual() {
             reference: ir::ReferenceQualification::Unqualified,
             is_const: false,
             is_virtual: true,
+            is_final: false,
+            is_explicit_ctor: false,
+        }),
+    );
+}
+
+#[test]
+fn test_member_function_final() {
+    assert_member_function_has_instance_method_metadata(
+        "Function",
+        "virtual void Function() final;",
+        &Some(ir::InstanceMethodMetadata {
+            reference: ir::ReferenceQualification::Unqualified,
+            is_const: false,
+            is_virtual: true,
+            is_final: true,
+            is_explicit_ctor: false,
+        }),
+    );
+}
+
+#[test]
+fn test_member_function_of_final_class() {
+    let ir = ir_from_cc("struct Struct final { virtual void Function(); };").unwrap();
+    assert_member_function_with_predicate_has_instance_method_metadata(
+        &ir,
+        "Struct",
+        |f| f.name == UnqualifiedIdentifier::Identifier(ir_id("Function")),
+        &Some(ir::InstanceMethodMetadata {
+            reference: ir::ReferenceQualification::Unqualified,
+            is_const: false,
+            is_virtual: true,
+            is_final: true,
             is_explicit_ctor: false,
         }),
     );
@@ -2597,6 +2834,7 @@ fn test_member_function_lvalue() {
             reference: ir::ReferenceQualification::LValue,
             is_const: false,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: false,
         }),
     );
@@ -2611,6 +2849,7 @@ fn test_member_function_rvalue() {
             reference: ir::ReferenceQualification::RValue,
             is_const: false,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: false,
         }),
     );
@@ -2635,6 +2874,7 @@ fn test_member_function_explicit_constructor() {
             reference: ir::ReferenceQualification::Unqualified,
             is_const: false,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: true,
         }),
     );
@@ -2659,6 +2899,7 @@ fn test_member_function_implicit_constructor() {
             reference: ir::ReferenceQualification::Unqualified,
             is_const: false,
             is_virtual: false,
+            is_final: false,
             is_explicit_ctor: false,
         }),
     );
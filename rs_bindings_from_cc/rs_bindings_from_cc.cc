@@ -6,13 +6,20 @@
 // * a Rust source file with bindings for the C++ API
 // * a C++ source file with the implementation of the bindings
 
+#include <sys/resource.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/flags/parse.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "common/file_io.h"
 #include "common/status_macros.h"
@@ -20,6 +27,11 @@
 #include "rs_bindings_from_cc/collect_namespaces.h"
 #include "rs_bindings_from_cc/generate_bindings_and_metadata.h"
 #include "rs_bindings_from_cc/ir.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 
 namespace crubit {
@@ -33,6 +45,50 @@ std::string InstantiationsAsJson(
   return std::string(llvm::formatv("{0:2}", llvm::json::Value(std::move(obj))));
 }
 
+// Returns the number of IR items of each kind, keyed by the name used for the
+// kind in the JSON IR (e.g. "Func" or "Record").
+llvm::json::Object IrItemCounts(const IR& ir) {
+  static constexpr absl::string_view kItemKindNames[] = {
+      "Func", "Record", "IncompleteRecord", "Enum", "TypeAlias",
+      "UnsupportedItem", "Comment", "Namespace", "UseMod"};
+  static_assert(std::size(kItemKindNames) == std::variant_size_v<IR::Item>);
+  std::vector<int64_t> counts(std::size(kItemKindNames));
+  for (const IR::Item& item : ir.items) {
+    ++counts[item.index()];
+  }
+  llvm::json::Object result;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    result[kItemKindNames[i]] = counts[i];
+  }
+  return result;
+}
+
+// Writes the events recorded by the `llvm::TimeTraceProfiler` to `path` in the
+// Chrome trace event format. The peak RSS of the process, the number of items
+// in `ir`, and the number of output files that were left untouched because
+// their contents didn't change are added as `otherData`.
+absl::Status WriteProfile(absl::string_view path, const IR& ir) {
+  llvm::SmallString<0> trace;
+  llvm::raw_svector_ostream trace_stream(trace);
+  llvm::timeTraceProfilerWrite(trace_stream);
+  llvm::Expected<llvm::json::Value> json = llvm::json::parse(trace);
+  if (!json) {
+    return absl::InternalError(llvm::toString(json.takeError()));
+  }
+
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return absl::InternalError("getrusage failed");
+  }
+  json->getAsObject()->insert(
+      {"otherData", llvm::json::Object{
+                        {"peak_rss_kb", static_cast<int64_t>(usage.ru_maxrss)},
+                        {"ir_item_counts", IrItemCounts(ir)},
+                        {"skipped_file_writes", GetSkippedFileWritesCount()},
+                    }});
+  return SetFileContents(path, std::string(llvm::formatv("{0}", *json)));
+}
+
 absl::Status Main(absl::Span<char* const> args) {
   CRUBIT_ASSIGN_OR_RETURN(Cmdline cmdline, Cmdline::Create());
 
@@ -53,6 +109,13 @@ absl::Status Main(absl::Span<char* const> args) {
     return absl::OkStatus();
   }
 
+  if (!cmdline.profile_out().empty()) {
+    // Events shorter than the granularity (in microseconds) are only counted
+    // in the per-name totals.
+    llvm::timeTraceProfilerInitialize(/*TimeTraceGranularity=*/500,
+                                      "rs_bindings_from_cc");
+  }
+
   std::vector<std::string> clang_args;
   clang_args.insert(clang_args.end(), args.begin(), args.end());
 
@@ -67,6 +130,17 @@ absl::Status Main(absl::Span<char* const> args) {
 
   CRUBIT_RETURN_IF_ERROR(
       SetFileContents(cmdline.rs_out(), bindings_and_metadata.rs_api));
+  if (!cmdline.rs_out_shards_dir().empty()) {
+    if (std::error_code error_code =
+            llvm::sys::fs::create_directories(cmdline.rs_out_shards_dir())) {
+      return absl::InternalError(error_code.message());
+    }
+    for (const auto& [file_name, contents] :
+         bindings_and_metadata.rs_api_shards) {
+      CRUBIT_RETURN_IF_ERROR(SetFileContents(
+          absl::StrCat(cmdline.rs_out_shards_dir(), "/", file_name), contents));
+    }
+  }
   CRUBIT_RETURN_IF_ERROR(
       SetFileContents(cmdline.cc_out(), bindings_and_metadata.rs_api_impl));
 
@@ -87,6 +161,13 @@ absl::Status Main(absl::Span<char* const> args) {
                                            bindings_and_metadata.error_report));
   }
 
+  if (!cmdline.profile_out().empty()) {
+    absl::Status status =
+        WriteProfile(cmdline.profile_out(), bindings_and_metadata.ir);
+    llvm::timeTraceProfilerCleanup();
+    CRUBIT_RETURN_IF_ERROR(status);
+  }
+
   return absl::OkStatus();
 }
 
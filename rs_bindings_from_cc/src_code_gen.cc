@@ -4,13 +4,15 @@
 
 #include "rs_bindings_from_cc/src_code_gen.h"
 
+#include <map>
 #include <string>
 
+#include "absl/strings/str_cat.h"
 #include "common/ffi_types.h"
-#include "common/status_macros.h"
 #include "rs_bindings_from_cc/ir.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/JSON.h"
+#include "llvm/Support/TimeProfiler.h"
 
 namespace crubit {
 
@@ -18,29 +20,56 @@ namespace crubit {
 struct FfiBindings {
   FfiU8SliceBox rs_api;
   FfiU8SliceBox rs_api_impl;
+  FfiU8SliceBox rs_api_shards;
   FfiU8SliceBox error_report;
 };
 
+// Callbacks through which the Rust code reports the time spent in the phases
+// of bindings generation. Both are null when profiling is disabled.
+struct FfiProfilerHooks {
+  void (*begin)(FfiU8Slice name);
+  void (*end)();
+};
+
+static void TimeTraceBegin(FfiU8Slice name) {
+  llvm::timeTraceProfilerBegin(StringViewFromFfiU8Slice(name), "");
+}
+
+static void TimeTraceEnd() { llvm::timeTraceProfilerEnd(); }
+
 // This function is implemented in Rust.
 extern "C" FfiBindings GenerateBindingsImpl(FfiU8Slice json,
                                             FfiU8Slice crubit_support_path,
                                             FfiU8Slice clang_format_exe_path,
                                             FfiU8Slice rustfmt_exe_path,
                                             FfiU8Slice rustfmt_config_path,
-                                            bool generate_error_report);
+                                            FfiU8Slice rs_api_shards_path,
+                                            bool generate_error_report,
+                                            bool compact_layout_assertions,
+                                            FfiProfilerHooks profiler_hooks);
 
 // Creates `Bindings` instance from copied data from `ffi_bindings`.
 static absl::StatusOr<Bindings> MakeBindingsFromFfiBindings(
     const FfiBindings& ffi_bindings) {
+  llvm::TimeTraceScope time_trace("MakeBindingsFromFfiBindings");
   Bindings bindings;
 
   const FfiU8SliceBox& rs_api = ffi_bindings.rs_api;
   const FfiU8SliceBox& rs_api_impl = ffi_bindings.rs_api_impl;
+  const FfiU8SliceBox& rs_api_shards = ffi_bindings.rs_api_shards;
   const FfiU8SliceBox& error_report = ffi_bindings.error_report;
 
   bindings.rs_api = std::string(rs_api.ptr, rs_api.size);
   bindings.rs_api_impl = std::string(rs_api_impl.ptr, rs_api_impl.size);
   bindings.error_report = std::string(error_report.ptr, error_report.size);
+
+  auto shards = llvm::json::parse<std::map<std::string, std::string>>(
+      llvm::StringRef(rs_api_shards.ptr, rs_api_shards.size));
+  if (auto err = shards.takeError()) {
+    return absl::InternalError(absl::StrCat(
+        "Malformed `rs_api_shards` JSON: ", llvm::toString(std::move(err))));
+  }
+  bindings.rs_api_shards = std::move(*shards);
   return bindings;
 }
 
@@ -48,21 +77,31 @@ static absl::StatusOr<Bindings> MakeBindingsFromFfiBindings(
 static void FreeFfiBindings(FfiBindings ffi_bindings) {
   FreeFfiU8SliceBox(ffi_bindings.rs_api);
   FreeFfiU8SliceBox(ffi_bindings.rs_api_impl);
+  FreeFfiU8SliceBox(ffi_bindings.rs_api_shards);
   FreeFfiU8SliceBox(ffi_bindings.error_report);
 }
 
 absl::StatusOr<Bindings> GenerateBindings(
     const IR& ir, absl::string_view crubit_support_path,
     absl::string_view clang_format_exe_path, absl::string_view rustfmt_exe_path,
-    absl::string_view rustfmt_config_path, bool generate_error_report) {
-  std::string json = llvm::formatv("{0}", ir.ToJson());
+    absl::string_view rustfmt_config_path, absl::string_view rs_api_shards_path,
+    bool generate_error_report, bool compact_layout_assertions) {
+  std::string json;
+  {
+    llvm::TimeTraceScope time_trace("IR::ToJson");
+    json = llvm::formatv("{0}", ir.ToJson());
+  }
 
+  FfiProfilerHooks profiler_hooks = {.begin = nullptr, .end = nullptr};
+  if (llvm::timeTraceProfilerEnabled()) {
+    profiler_hooks = {.begin = &TimeTraceBegin, .end = &TimeTraceEnd};
+  }
   FfiBindings ffi_bindings = GenerateBindingsImpl(
       MakeFfiU8Slice(json), MakeFfiU8Slice(crubit_support_path),
       MakeFfiU8Slice(clang_format_exe_path), MakeFfiU8Slice(rustfmt_exe_path),
-      MakeFfiU8Slice(rustfmt_config_path), generate_error_report);
-  CRUBIT_ASSIGN_OR_RETURN(Bindings bindings,
-                          MakeBindingsFromFfiBindings(ffi_bindings));
+      MakeFfiU8Slice(rustfmt_config_path), MakeFfiU8Slice(rs_api_shards_path),
+      generate_error_report, compact_layout_assertions, profiler_hooks);
+  absl::StatusOr<Bindings> bindings = MakeBindingsFromFfiBindings(ffi_bindings);
   FreeFfiBindings(ffi_bindings);
   return bindings;
 }
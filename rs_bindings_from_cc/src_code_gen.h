@@ -5,6 +5,7 @@
 #ifndef CRUBIT_RS_BINDINGS_FROM_CC_SRC_CODE_GEN_H_
 #define CRUBIT_RS_BINDINGS_FROM_CC_SRC_CODE_GEN_H_
 
+#include <map>
 #include <string>
 
 #include "absl/status/statusor.h"
@@ -19,15 +20,28 @@ struct Bindings {
   std::string rs_api;
   // C++ source code.
   std::string rs_api_impl;
+  // Rust source code of the modules split out of `rs_api`, keyed by file name
+  // (relative to the shards directory). Empty unless sharding was requested.
+  std::map<std::string, std::string> rs_api_shards;
   // Optional JSON error report.
   std::string error_report;
 };
 
 // Generates bindings from the given `IR`.
+//
+// If `rs_api_shards_path` is not empty, then top-level namespace modules are
+// split out of `rs_api` into `rs_api_shards`, and `rs_api` refers to them via
+// `#[path = "<rs_api_shards_path>/<file name>"]`.
+//
+// If `compact_layout_assertions` is true, then the size, alignment and field
+// offset assertions of all the records are aggregated into a single
+// table-driven check in `rs_api` and a single `static_assert` in
+// `rs_api_impl`.
 absl::StatusOr<Bindings> GenerateBindings(
     const IR& ir, absl::string_view crubit_support_path,
     absl::string_view clang_format_exe_path, absl::string_view rustfmt_exe_path,
-    absl::string_view rustfmt_config_path, bool generate_error_report);
+    absl::string_view rustfmt_config_path, absl::string_view rs_api_shards_path,
+    bool generate_error_report, bool compact_layout_assertions);
 
 }  // namespace crubit
 
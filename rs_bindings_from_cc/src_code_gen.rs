@@ -12,7 +12,8 @@ use itertools::Itertools;
 use once_cell::sync::Lazy;
 use proc_macro2::{Ident, Literal, TokenStream};
 use quote::{format_ident, quote, ToTokens};
-use std::collections::{BTreeSet, HashMap, HashSet};
+use std::cell::Cell;
+use std::collections::{BTreeMap, BTreeSet, HashMap, HashSet};
 use std::ffi::{OsStr, OsString};
 use std::fmt::Write as _;
 use std::iter::{self, Iterator};
@@ -22,7 +23,7 @@ use std::process;
 use std::ptr;
 use std::rc::Rc;
 use token_stream_printer::{
-    cc_tokens_to_formatted_string, rs_tokens_to_formatted_string, RustfmtConfig,
+    rs_and_cc_tokens_to_formatted_strings, rs_tokens_to_formatted_strings, RustfmtConfig,
 };
 
 /// FFI equivalent of `Bindings`.
@@ -30,6 +31,7 @@ use token_stream_printer::{
 pub struct FfiBindings {
     rs_api: FfiU8SliceBox,
     rs_api_impl: FfiU8SliceBox,
+    rs_api_shards: FfiU8SliceBox,
     error_report: FfiU8SliceBox,
 }
 
@@ -48,14 +50,20 @@ pub struct FfiBindings {
 ///      FfiU8Slice for a valid array of bytes representing an UTF8-encoded
 ///      string (without the UTF-8 requirement, it seems that Rust doesn't offer
 ///      a way to convert to OsString on Windows)
-///    * `json`, `crubit_support_path`, `rustfmt_exe_path`, and
-///      `rustfmt_config_path` shouldn't change during the call.
+///    * `rs_api_shards_path` should be a FfiU8Slice for a valid array of bytes
+///      representing an UTF8-encoded string (empty if `rs_api` should not be
+///      split into shards)
+///    * `json`, `crubit_support_path`, `rustfmt_exe_path`,
+///      `rustfmt_config_path`, and `rs_api_shards_path` shouldn't change
+///      during the call.
 ///
 /// Ownership:
 ///    * function doesn't take ownership of (in other words it borrows) the
-///      input params: `json`, `crubit_support_path`, `rustfmt_exe_path`, and
-///      `rustfmt_config_path`
+///      input params: `json`, `crubit_support_path`, `rustfmt_exe_path`,
+///      `rustfmt_config_path`, and `rs_api_shards_path`
 ///    * function passes ownership of the returned value to the caller
+///    * `profiler_hooks` should either be null or point to functions that are
+///      safe to call (from the current thread) during the call
 #[no_mangle]
 pub unsafe extern "C" fn GenerateBindingsImpl(
     json: FfiU8Slice,
@@ -63,7 +71,10 @@ pub unsafe extern "C" fn GenerateBindingsImpl(
     clang_format_exe_path: FfiU8Slice,
     rustfmt_exe_path: FfiU8Slice,
     rustfmt_config_path: FfiU8Slice,
+    rs_api_shards_path: FfiU8Slice,
     generate_error_report: bool,
+    compact_layout_assertions: bool,
+    profiler_hooks: FfiProfilerHooks,
 ) -> FfiBindings {
     let json: &[u8] = json.as_slice();
     let crubit_support_path: &str = std::str::from_utf8(crubit_support_path.as_slice()).unwrap();
@@ -73,7 +84,9 @@ pub unsafe extern "C" fn GenerateBindingsImpl(
         std::str::from_utf8(rustfmt_exe_path.as_slice()).unwrap().into();
     let rustfmt_config_path: OsString =
         std::str::from_utf8(rustfmt_config_path.as_slice()).unwrap().into();
-    catch_unwind(|| {
+    let rs_api_shards_path: &str = std::str::from_utf8(rs_api_shards_path.as_slice()).unwrap();
+    PROFILER_HOOKS.with(|hooks| hooks.set(profiler_hooks));
+    let ffi_bindings = catch_unwind(|| {
         // It is ok to abort here.
         let mut error_report;
         let mut ignore_errors;
@@ -84,12 +97,14 @@ pub unsafe extern "C" fn GenerateBindingsImpl(
             ignore_errors = IgnoreErrors;
             &mut ignore_errors
         };
-        let Bindings { rs_api, rs_api_impl } = generate_bindings(
+        let Bindings { rs_api, rs_api_impl, rs_api_shards } = generate_bindings(
             json,
             crubit_support_path,
             &clang_format_exe_path,
             &rustfmt_exe_path,
             &rustfmt_config_path,
+            rs_api_shards_path,
+            compact_layout_assertions,
             errors,
         )
         .unwrap();
@@ -98,12 +113,61 @@ pub unsafe extern "C" fn GenerateBindingsImpl(
             rs_api_impl: FfiU8SliceBox::from_boxed_slice(
                 rs_api_impl.into_bytes().into_boxed_slice(),
             ),
+            rs_api_shards: FfiU8SliceBox::from_boxed_slice(
+                serde_json::to_vec(&rs_api_shards).unwrap().into_boxed_slice(),
+            ),
             error_report: FfiU8SliceBox::from_boxed_slice(
                 errors.serialize_to_vec().unwrap().into_boxed_slice(),
             ),
         }
     })
-    .unwrap_or_else(|_| process::abort())
+    .unwrap_or_else(|_| process::abort());
+    PROFILER_HOOKS.with(|hooks| hooks.set(FfiProfilerHooks::default()));
+    ffi_bindings
+}
+
+/// FFI equivalent of the C++ `FfiProfilerHooks`: callbacks through which the
+/// time spent in the phases of bindings generation is reported to the C++
+/// profiler (see `--profile_out`).  Both are null when profiling is disabled.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct FfiProfilerHooks {
+    begin: Option<unsafe extern "C" fn(name: FfiU8Slice)>,
+    end: Option<unsafe extern "C" fn()>,
+}
+
+thread_local! {
+    static PROFILER_HOOKS: Cell<FfiProfilerHooks> = Cell::new(FfiProfilerHooks::default());
+}
+
+/// Ends the profiler event started by `profile_scope` when dropped.
+struct ProfileScope {
+    end: Option<unsafe extern "C" fn()>,
+}
+
+impl Drop for ProfileScope {
+    fn drop(&mut self) {
+        if let Some(end) = self.end {
+            // SAFETY: `GenerateBindingsImpl` requires the hooks to be safe to call.
+            unsafe { end() }
+        }
+    }
+}
+
+/// Reports the time until the returned guard is dropped as an event called
+/// `name` to the profiler hooks installed by `GenerateBindingsImpl`.  This is a
+/// no-op when profiling is disabled.
+#[must_use]
+fn profile_scope(name: &str) -> ProfileScope {
+    let hooks = PROFILER_HOOKS.with(Cell::get);
+    match (hooks.begin, hooks.end) {
+        (Some(begin), Some(end)) => {
+            // SAFETY: `GenerateBindingsImpl` requires the hooks to be safe to call.
+            unsafe { begin(FfiU8Slice::from_slice(name.as_bytes())) };
+            ProfileScope { end: Some(end) }
+        }
+        _ => ProfileScope { end: None },
+    }
 }
 
 #[salsa::query_group(BindingsGeneratorStorage)]
@@ -111,6 +175,11 @@ trait BindingsGenerator {
     #[salsa::input]
     fn ir(&self) -> Rc<IR>;
 
+    /// Whether layout assertions are aggregated into a single table-driven
+    /// check per target (see `--compact_layout_assertions`).
+    #[salsa::input]
+    fn compact_layout_assertions(&self) -> bool;
+
     fn rs_type_kind(&self, rs_type: RsType) -> Result<RsTypeKind>;
 
     fn generate_func(&self, func: Rc<Func>) -> Result<Option<(Rc<GeneratedItem>, Rc<FunctionId>)>>;
@@ -140,6 +209,10 @@ struct Bindings {
     rs_api: String,
     // C++ source code.
     rs_api_impl: String,
+    // Rust source code of the modules split out of `rs_api`, keyed by file
+    // name (relative to the shards directory).  Empty unless sharding was
+    // requested.
+    rs_api_shards: BTreeMap<String, String>,
 }
 
 /// Source code for generated bindings, as tokens.
@@ -148,31 +221,69 @@ struct BindingsTokens {
     rs_api: TokenStream,
     // C++ source code.
     rs_api_impl: TokenStream,
+    // Rust source code of the modules split out of `rs_api`, keyed by file
+    // name (relative to the shards directory).
+    rs_api_shards: BTreeMap<String, TokenStream>,
 }
 
+/// Maximum number of `rustfmt` processes used to format `rs_api` shards.
+const MAX_CONCURRENT_SHARD_FORMATTERS: usize = 8;
+
 fn generate_bindings(
     json: &[u8],
     crubit_support_path: &str,
     clang_format_exe_path: &OsStr,
     rustfmt_exe_path: &OsStr,
     rustfmt_config_path: &OsStr,
+    rs_api_shards_path: &str,
+    compact_layout_assertions: bool,
     errors: &mut dyn ErrorReporting,
 ) -> Result<Bindings> {
-    let ir = Rc::new(deserialize_ir(json)?);
+    let ir = {
+        let _scope = profile_scope("deserialize_ir");
+        Rc::new(deserialize_ir(json)?)
+    };
 
-    let BindingsTokens { rs_api, rs_api_impl } =
-        generate_bindings_tokens(ir.clone(), crubit_support_path, errors)?;
-    let rs_api = {
+    let rs_api_shards_path =
+        if rs_api_shards_path.is_empty() { None } else { Some(rs_api_shards_path) };
+    let BindingsTokens { rs_api, rs_api_impl, rs_api_shards } = {
+        let _scope = profile_scope("generate_bindings_tokens");
+        generate_bindings_tokens(
+            ir.clone(),
+            crubit_support_path,
+            rs_api_shards_path,
+            compact_layout_assertions,
+            errors,
+        )?
+    };
+    let rustfmt_config = {
         let rustfmt_exe_path = Path::new(rustfmt_exe_path);
         let rustfmt_config_path = if rustfmt_config_path.is_empty() {
             None
         } else {
             Some(Path::new(rustfmt_config_path))
         };
-        let rustfmt_config = RustfmtConfig::new(rustfmt_exe_path, rustfmt_config_path);
-        rs_tokens_to_formatted_string(rs_api, &rustfmt_config)?
+        RustfmtConfig::new(rustfmt_exe_path, rustfmt_config_path)
+    };
+    let (rs_api, rs_api_impl) = {
+        let _scope = profile_scope("rustfmt and clang-format");
+        rs_and_cc_tokens_to_formatted_strings(
+            rs_api,
+            &rustfmt_config,
+            rs_api_impl,
+            Path::new(clang_format_exe_path),
+        )?
+    };
+    let (rs_api_shard_names, rs_api_shards): (Vec<String>, Vec<TokenStream>) =
+        rs_api_shards.into_iter().unzip();
+    let rs_api_shards = {
+        let _scope = profile_scope("rustfmt (rs_api shards)");
+        rs_tokens_to_formatted_strings(
+            rs_api_shards,
+            &rustfmt_config,
+            MAX_CONCURRENT_SHARD_FORMATTERS,
+        )?
     };
-    let rs_api_impl = cc_tokens_to_formatted_string(rs_api_impl, Path::new(clang_format_exe_path))?;
 
     // Add top-level comments that help identify where the generated bindings came
     // from.
@@ -190,11 +301,20 @@ fn generate_bindings(
         // current build environment returns a guid-like path... :-/
         //
         // TODO(b/255784681): Consider including cmdline arguments.
-        let target = &ir.current_target().0;
-        format!(
-            "// Automatically @generated Rust bindings for the following C++ target:\n\
-            // {target}\n"
-        )
+        if ir.crate_root_path().is_some() {
+            // Bindings of template instantiations don't depend on the target that requested
+            // them, so a stored run can be reused by other targets that request exactly the
+            // same instantiations (see `--instantiations_cache_dir`).
+            "// Automatically @generated Rust bindings for C++ class template instantiations\n\
+            // requested via `cc_template!`\n"
+                .to_string()
+        } else {
+            let target = &ir.current_target().0;
+            format!(
+                "// Automatically @generated Rust bindings for the following C++ target:\n\
+                // {target}\n"
+            )
+        }
     };
     // TODO(lukasza): Try to remove `#![rustfmt:skip]` - in theory it shouldn't
     // be needed when `@generated` comment/keyword is present...
@@ -207,8 +327,12 @@ fn generate_bindings(
         "{top_level_comment}\n\
         {rs_api_impl}"
     );
+    let rs_api_shards = rs_api_shard_names
+        .into_iter()
+        .zip(rs_api_shards.into_iter().map(|shard| format!("{top_level_comment}\n{shard}")))
+        .collect();
 
-    Ok(Bindings { rs_api, rs_api_impl })
+    Ok(Bindings { rs_api, rs_api_impl, rs_api_shards })
 }
 
 /// If we know the original C++ function is codegenned and already compatible
@@ -227,14 +351,22 @@ fn can_skip_cc_thunk(db: &dyn BindingsGenerator, func: &Func) -> bool {
     // This is not great runtime-performance-wise in regular builds (inline function
     // will not be inlined, there will always be a function call), but it is
     // correct. ThinLTO builds will be able to see through the thunk and inline
-    // code across the language boundary. For non-ThinLTO builds we plan to
-    // implement <internal link> which removes the runtime performance overhead.
+    // code across the language boundary: building with
+    // `--//rs_bindings_from_cc/bazel_support:cross_language_inlining` compiles
+    // the thunks to bitcode for rustc's `-Clinker-plugin-lto`. For non-ThinLTO
+    // builds we plan to implement <internal link> which removes the runtime
+    // performance overhead.
+    //
+    // Trivial inline functions (see `Func::inline_body`) are implemented in Rust
+    // instead, and don't need the thunk either (see `has_inline_rs_body`).
     if func.is_inline {
         return false;
     }
     // ## Member functions (or descendants) of class templates
     //
-    // A thunk is required to force/guarantee template instantiation.
+    // A thunk is required to force/guarantee template instantiation. Every target
+    // that uses the instantiation emits the same `inline` thunk, and the linker
+    // keeps only one copy (see `docs/thunks_for_class_template_member_functions.md`).
     if func.is_member_or_descendant_of_class_template {
         return false;
     }
@@ -252,9 +384,13 @@ fn can_skip_cc_thunk(db: &dyn BindingsGenerator, func: &Func) -> bool {
     // In terms of runtime performance, since this only occurs for virtual function
     // calls, which are already slow, it may not be such a big deal. We can
     // benchmark it later. :)
+    //
+    // If the function or its class is `final`, then there is nothing to dispatch
+    // to: the concrete `A::Method` impl is always the one that gets called, and
+    // we can call it directly.
     if let Some(meta) = &func.member_func_metadata {
         if let Some(inst_meta) = &meta.instance_method_metadata {
-            if inst_meta.is_virtual {
+            if inst_meta.is_virtual && !inst_meta.is_final {
                 return false;
             }
         }
@@ -278,11 +414,17 @@ fn can_skip_cc_thunk(db: &dyn BindingsGenerator, func: &Func) -> bool {
     // now, this is worked around via an _explicit_ output parameter, used in
     // the thunk, which cannot be skipped anymore.
     //
+    // `!Unpin` records that are trivial for the purpose of calls (e.g. non-final
+    // structs, or `[[clang::trivial_abi]]` types) are returned like C structs,
+    // though. If their Rust struct has the same fields as the C++ one, then the
+    // Rust `extern "C"` declaration returns them the same way, and the returned
+    // value can be moved into its final location by `memcpy`.
+    //
     // Note: if the RsTypeKind cannot be parsed / rs_type_kind returns Err, then
     // bindings generation will fail for this function, so it doesn't really matter
     // what we do here.
     if let Ok(return_type) = db.rs_type_kind(func.return_type.rs_type.clone()) {
-        if !return_type.is_unpin() {
+        if !return_type.is_unpin() && !is_returned_like_c_struct(db, &return_type) {
             return false;
         }
     }
@@ -297,6 +439,9 @@ fn can_skip_cc_thunk(db: &dyn BindingsGenerator, func: &Func) -> bool {
     // if by magic.
     //
     // And so for now, we always use C++11 semantics, via an intermediate thunk.
+    // This applies to `[[clang::trivial_abi]]` types as well: the thunk is what
+    // runs the move constructor of the parameter, and the Rust caller still
+    // owns (and will destroy) the moved-from value.
     //
     // (As a side effect, this, like return values, means that support is
     // ABI-agnostic.)
@@ -311,6 +456,219 @@ fn can_skip_cc_thunk(db: &dyn BindingsGenerator, func: &Func) -> bool {
     true
 }
 
+/// Returns true if `func` is implemented in Rust by translating its
+/// `inline_body`, so that neither a Rust thunk declaration nor a C++ thunk is
+/// needed.
+fn has_inline_rs_body(db: &dyn BindingsGenerator, func: &Func) -> bool {
+    generate_inline_rs_body(db, func, &quote! { self }).is_some()
+}
+
+/// Translates `func.inline_body` to Rust, or returns `None` if `func` has to be
+/// called through a thunk.
+///
+/// `this` is the Rust place expression for `*this` (e.g. `self`).
+fn generate_inline_rs_body(
+    db: &dyn BindingsGenerator,
+    func: &Func,
+    this: &TokenStream,
+) -> Option<TokenStream> {
+    let inline_body = func.inline_body.as_ref()?;
+    // Names other than identifiers are bound to traits, which call thunks.
+    if !matches!(func.name, UnqualifiedIdentifier::Identifier(_)) {
+        return None;
+    }
+    let ir = db.ir();
+    let record = match &func.member_func_metadata {
+        Some(meta) => {
+            let record: &Rc<Record> = ir.find_decl(meta.record_id).ok()?;
+            // Reading a union field is `unsafe` in Rust.
+            if record.is_union() {
+                return None;
+            }
+            Some(record.clone())
+        }
+        None => None,
+    };
+    let (tokens, _) = inline_expr_to_rs(db, func, record.as_deref(), this, inline_body)?;
+
+    // The generated bindings `#![deny(warnings)]`, including unused variables
+    // (other than `__this`, `__param_0`, etc.).
+    let mut used_params = HashSet::new();
+    collect_inline_expr_params(inline_body, &mut used_params);
+    let unused_params = func
+        .params
+        .iter()
+        .enumerate()
+        .filter(|(index, param)| {
+            !used_params.contains(index) && !param.identifier.identifier.starts_with('_')
+        })
+        .map(|(_, param)| make_rs_ident(&param.identifier.identifier));
+    Some(quote! {
+        #( let _ = #unused_params; )*
+        #tokens
+    })
+}
+
+fn collect_inline_expr_params(expr: &InlineExpr, params: &mut HashSet<usize>) {
+    match expr {
+        InlineExpr::Param(index) => {
+            params.insert(*index);
+        }
+        InlineExpr::UnaryOp { operand, .. } => collect_inline_expr_params(operand, params),
+        InlineExpr::BinaryOp { lhs, rhs, .. } => {
+            collect_inline_expr_params(lhs, params);
+            collect_inline_expr_params(rhs, params);
+        }
+        InlineExpr::Field { .. }
+        | InlineExpr::IntegerLiteral { .. }
+        | InlineExpr::BoolLiteral(_) => {}
+    }
+}
+
+/// Translates `expr` to Rust. The returned bool is true if the expression needs
+/// to be parenthesized when used as an operand (or as the receiver of a method
+/// call).
+fn inline_expr_to_rs(
+    db: &dyn BindingsGenerator,
+    func: &Func,
+    record: Option<&Record>,
+    this: &TokenStream,
+    expr: &InlineExpr,
+) -> Option<(TokenStream, bool)> {
+    let operand = |expr: &InlineExpr| -> Option<TokenStream> {
+        let (tokens, is_operator) = inline_expr_to_rs(db, func, record, this, expr)?;
+        Some(if is_operator {
+            quote! { (#tokens) }
+        } else {
+            tokens
+        })
+    };
+    match expr {
+        InlineExpr::Param(index) => {
+            let param = func.params.get(*index)?;
+            let ident = make_rs_ident(&param.identifier.identifier);
+            Some((quote! { #ident }, false))
+        }
+        InlineExpr::Field { identifier, type_ } => {
+            let (field_index, field) = record?
+                .fields
+                .iter()
+                .enumerate()
+                .find(|(_, field)| field.identifier.as_ref() == Some(identifier))?;
+            let field_ident = make_rs_field_ident(field, field_index);
+            if field.access == AccessSpecifier::Public
+                && get_field_rs_type_for_layout(field).is_ok()
+            {
+                Some((quote! { #this.#field_ident }, false))
+            } else {
+                // Non-public fields are represented as opaque blobs of bytes, whose
+                // offset is verified by the layout assertions of the record.
+                let field_type = db.rs_type_kind(type_.rs_type.clone()).ok()?;
+                Some((
+                    quote! {
+                        unsafe { ::std::ptr::addr_of!(#this.#field_ident).cast::<#field_type>().read() }
+                    },
+                    true,
+                ))
+            }
+        }
+        InlineExpr::IntegerLiteral { value, type_ } => {
+            // The type suffix is required: Rust can't call methods like `wrapping_add` on
+            // literals of an ambiguous integer type.
+            let suffix = type_.rs_type.name.as_deref()?;
+            if !matches!(suffix, "i8" | "i16" | "i32" | "i64" | "u8" | "u16" | "u32" | "u64") {
+                return None;
+            }
+            let literal = syn::LitInt::new(
+                &format!("{}{}", value.wrapped_value, suffix),
+                proc_macro2::Span::call_site(),
+            );
+            Some((quote! { #literal }, false))
+        }
+        InlineExpr::BoolLiteral(value) => Some((quote! { #value }, false)),
+        InlineExpr::UnaryOp { op, is_integral, operand: operand_expr } => {
+            let operand = operand(operand_expr)?;
+            match (op.as_ref(), is_integral) {
+                // Negation of unsigned integers wraps around in C++.
+                ("-", true) => Some((quote! { #operand.wrapping_neg() }, false)),
+                ("-", false) => Some((quote! { -#operand }, true)),
+                ("~" | "!", _) => Some((quote! { !#operand }, true)),
+                _ => None,
+            }
+        }
+        InlineExpr::BinaryOp { op, is_integral, lhs, rhs } => {
+            let lhs = operand(lhs)?;
+            // Signed overflow is undefined behavior in C++, and unsigned arithmetic
+            // wraps around, so wrapping arithmetic is correct in both cases.
+            let wrapping_method = match (op.as_ref(), is_integral) {
+                ("+", true) => Some(make_rs_ident("wrapping_add")),
+                ("-", true) => Some(make_rs_ident("wrapping_sub")),
+                ("*", true) => Some(make_rs_ident("wrapping_mul")),
+                _ => None,
+            };
+            if let Some(method) = wrapping_method {
+                let (rhs, _) = inline_expr_to_rs(db, func, record, this, rhs)?;
+                Some((quote! { #lhs.#method(#rhs) }, false))
+            } else {
+                let rhs = operand(rhs)?;
+                let op = syn::parse_str::<TokenStream>(op).ok()?;
+                Some((quote! { #lhs #op #rhs }, true))
+            }
+        }
+    }
+}
+
+/// Returns true if a C++ function returns values of the `!Unpin` type
+/// `rs_type_kind` the same way as a Rust `extern "C"` function returns the
+/// generated Rust struct, so that no thunk is needed to return it.
+///
+/// This is the case if the C++ record can be passed in registers (see
+/// `Record::is_trivial_abi`), and if the generated Rust struct represents all
+/// of its fields with their actual types (rather than as opaque blobs of bytes,
+/// which may be classified differently by the calling convention).
+fn is_returned_like_c_struct(db: &dyn BindingsGenerator, rs_type_kind: &RsTypeKind) -> bool {
+    match rs_type_kind {
+        RsTypeKind::Record { record, .. } => {
+            record.is_trivial_abi && has_c_compatible_layout(db, rs_type_kind)
+        }
+        RsTypeKind::TypeAlias { underlying_type, .. } => {
+            is_returned_like_c_struct(db, underlying_type)
+        }
+        _ => false,
+    }
+}
+
+/// Returns true if the generated Rust type has the same fields, with the same
+/// types, as the C++ type.
+fn has_c_compatible_layout(db: &dyn BindingsGenerator, rs_type_kind: &RsTypeKind) -> bool {
+    match rs_type_kind {
+        RsTypeKind::Record { record, .. } => {
+            !record.is_union()
+                && !record.fields.is_empty()
+                // Base class subobjects are represented as a leading blob of bytes.
+                && record.fields[0].offset == 0
+                && record.fields.iter().all(|field| {
+                    !field.is_bitfield
+                        && get_field_rs_type_for_layout(field).map_or(false, |rs_type| {
+                            db.rs_type_kind(rs_type.clone())
+                                .map_or(false, |field_type| has_c_compatible_layout(db, &field_type))
+                        })
+                })
+        }
+        RsTypeKind::TypeAlias { underlying_type, .. } => {
+            has_c_compatible_layout(db, underlying_type)
+        }
+        RsTypeKind::Pointer { .. }
+        | RsTypeKind::Reference { .. }
+        | RsTypeKind::FuncPtr { .. }
+        | RsTypeKind::Slice { .. } => true,
+        RsTypeKind::Other { type_args, .. } => type_args.is_empty(),
+        RsTypeKind::IncompleteRecord { .. }
+        | RsTypeKind::RvalueReference { .. }
+        | RsTypeKind::Unit => false,
+    }
+}
+
 /// Uniquely identifies a generated Rust function.
 #[derive(Clone, Debug, PartialEq, Eq, Hash)]
 struct FunctionId {
@@ -720,7 +1078,11 @@ fn api_func_shape(
     let op_meta = &*OPERATOR_METADATA;
 
     let maybe_record: Option<&Rc<Record>> = ir.record_for_member_func(func)?;
-    let has_pointer_params = param_types.iter().any(|p| matches!(p, RsTypeKind::Pointer { .. }));
+    // `SliceRef` / `SliceMut` can be created from arbitrary raw parts, so they are
+    // as unsafe to dereference as raw pointers.
+    let has_pointer_params = param_types
+        .iter()
+        .any(|p| matches!(p, RsTypeKind::Pointer { .. } | RsTypeKind::Slice { .. }));
     let impl_kind: ImplKind;
     let func_name: syn::Ident;
 
@@ -1155,6 +1517,7 @@ fn get_binding(
     expected_function_name: UnqualifiedIdentifier,
     expected_param_types: Vec<RsTypeKind>,
 ) -> Option<(Ident, ImplKind)> {
+    let _scope = profile_scope("BindingsGenerator::get_binding");
     db.ir()
         // TODO(jeanpierreda): make this O(1) using a hash table lookup.
         .functions()
@@ -1179,6 +1542,7 @@ fn get_binding(
 /// Returns whether the given record either implements or derives the Clone
 /// trait.
 fn is_record_clonable(db: &dyn BindingsGenerator, record: Rc<Record>) -> bool {
+    let _scope = profile_scope("BindingsGenerator::is_record_clonable");
     if !record.is_unpin() {
         return false;
     }
@@ -1256,6 +1620,7 @@ fn generate_func(
     db: &dyn BindingsGenerator,
     func: Rc<Func>,
 ) -> Result<Option<(Rc<GeneratedItem>, Rc<FunctionId>)>> {
+    let _scope = profile_scope("BindingsGenerator::generate_func");
     let ir = db.ir();
     let crate_root_path = crate_root_path_tokens(&ir);
     let mut features = BTreeSet::new();
@@ -1283,7 +1648,21 @@ fn generate_func(
     return_type.check_by_value()?;
     let param_idents =
         func.params.iter().map(|p| make_rs_ident(&p.identifier.identifier)).collect_vec();
-    let thunk = generate_func_thunk(db, &func, &param_idents, &param_types, &return_type)?;
+    let inline_rs_body = {
+        // `__this` is formatted as `self`, unless it's a raw pointer.
+        let this = match param_idents.first() {
+            Some(this_ident) if !impl_kind.format_first_param_as_self() => {
+                quote! { (*#this_ident) }
+            }
+            _ => quote! { self },
+        };
+        generate_inline_rs_body(db, &func, &this)
+    };
+    let thunk = if inline_rs_body.is_some() {
+        quote! {}
+    } else {
+        generate_func_thunk(db, &func, &param_idents, &param_types, &return_type)?
+    };
 
     // If the Rust trait require a function to take the params by const reference
     // and the thunk takes some of its params by value then we should add a const
@@ -1365,10 +1744,11 @@ fn generate_func(
                     }
                 }
             }
+            _ if inline_rs_body.is_some() => inline_rs_body.unwrap(),
             _ => {
-                // Note: for the time being, all !Unpin values are treated as if they were not
-                // trivially relocatable. We could, in the special case of trivial !Unpin types,
-                // not generate the thunk at all, but this would be a bit of extra work.
+                // Note: for the time being, !Unpin values are treated as if they were not
+                // trivially relocatable, except for return values that are returned like C
+                // structs (see `is_returned_like_c_struct`), for which there is no thunk.
                 //
                 // TODO(jeanpierreda): separately handle non-Unpin and non-trivial types.
                 let mut body = if return_type.is_unpin() {
@@ -1382,9 +1762,21 @@ fn generate_func(
                         _ => None,
                     };
                     let return_type_or_self = return_type.to_token_stream_replacing_by_self(record);
+                    let init_dest = if can_skip_cc_thunk(db, &func) {
+                        // The value is returned like a C struct (see
+                        // `is_returned_like_c_struct`), and can be moved into `dest`.
+                        quote! {
+                            ::std::pin::Pin::into_inner_unchecked(dest).write(
+                                #crate_root_path::detail::#thunk_ident( #( #thunk_args ),* ));
+                        }
+                    } else {
+                        quote! {
+                            #crate_root_path::detail::#thunk_ident(::std::pin::Pin::into_inner_unchecked(dest) #( , #thunk_args )*);
+                        }
+                    };
                     quote! {
                         ::ctor::FnCtor::new(move |dest: ::std::pin::Pin<&mut ::std::mem::MaybeUninit<#return_type_or_self>>| {
-                            #crate_root_path::detail::#thunk_ident(::std::pin::Pin::into_inner_unchecked(dest) #( , #thunk_args )*);
+                            #init_dest
                         })
                     }
                 };
@@ -1835,7 +2227,7 @@ fn generate_func_thunk(
             )
         })?);
         out_param_ident = Some(param_idents.next().unwrap().clone());
-    } else if !return_type.is_unpin() {
+    } else if !return_type.is_unpin() && !can_skip_cc_thunk(db, func) {
         // For nontrivial return types, create a new out parameter.
         // The lifetime doesn't matter, so we can insert a new anonymous lifetime here.
         out_param = Some(quote! {
@@ -2218,32 +2610,37 @@ fn generate_record(
 
     let size = Literal::usize_unsuffixed(record.size);
     let alignment = Literal::usize_unsuffixed(record.alignment);
-    let field_offset_assertions = if record.is_union() {
+    let record_layout_checks = vec![
+        LayoutCheck {
+            actual: quote! { ::std::mem::size_of::<#qualified_ident>() },
+            expected: size,
+        },
+        LayoutCheck {
+            actual: quote! { ::std::mem::align_of::<#qualified_ident>() },
+            expected: alignment,
+        },
+    ];
+    let field_offset_checks = if record.is_union() {
         // TODO(https://github.com/Gilnaa/memoffset/issues/66): generate assertions for unions once
         // offsetof supports them.
         vec![]
     } else {
         fields_with_bounds
             .enumerate()
-            .map(|(field_index, (field, _, _, _))| {
-                if let Some(field) = field {
-                    let field_ident = make_rs_field_ident(field, field_index);
-
-                    // The assertion below reinforces that the division by 8 on the next line is
-                    // justified (because the bitfields have been coallesced / filtered out
-                    // earlier).
-                    assert_eq!(field.offset % 8, 0);
-                    let expected_offset = Literal::usize_unsuffixed(field.offset / 8);
-
-                    let actual_offset_expr = quote! {
-                        memoffset::offset_of!(#qualified_ident, #field_ident)
-                    };
-                    quote! {
-                        const _: () = assert!(#actual_offset_expr == #expected_offset);
-                    }
-                } else {
-                    quote! {}
-                }
+            .filter_map(|(field_index, (field, _, _, _))| {
+                let field = field?;
+                let field_ident = make_rs_field_ident(field, field_index);
+
+                // The assertion below reinforces that the division by 8 on the next line is
+                // justified (because the bitfields have been coallesced / filtered out
+                // earlier).
+                assert_eq!(field.offset % 8, 0);
+                let expected_offset = Literal::usize_unsuffixed(field.offset / 8);
+
+                Some(LayoutCheck {
+                    actual: quote! { memoffset::offset_of!(#qualified_ident, #field_ident) },
+                    expected: expected_offset,
+                })
             })
             .collect_vec()
     };
@@ -2335,11 +2732,13 @@ fn generate_record(
         .collect::<Result<Vec<_>>>()?;
 
     record_generated_items.push(cc_struct_upcast_impl(record, &ir)?);
+    record_generated_items.push(cc_struct_bulk_thunks_impl(db, record)?);
 
     let mut items = vec![];
     let mut thunks_from_record_items = vec![];
     let mut thunk_impls_from_record_items = vec![];
     let mut assertions_from_record_items = vec![];
+    let mut layout_checks_from_record_items = vec![];
 
     for generated in record_generated_items {
         items.push(generated.item);
@@ -2349,6 +2748,9 @@ fn generate_record(
         if !generated.assertions.is_empty() {
             assertions_from_record_items.push(generated.assertions);
         }
+        if !generated.layout_checks.is_empty() {
+            layout_checks_from_record_items.push(generated.layout_checks);
+        }
         if !generated.thunk_impls.is_empty() {
             thunk_impls_from_record_items.push(generated.thunk_impls);
         }
@@ -2399,9 +2801,21 @@ fn generate_record(
         add_conditional_assertion(should_implement_drop(record), quote! { Drop });
         assertions
     };
+    // With `--compact_layout_assertions` the layout checks are verified by a single
+    // assertion per target - see `generate_layout_checks_assertion`.
+    let (record_layout_assertions, field_offset_assertions, layout_check_rows) =
+        if db.compact_layout_assertions() {
+            let rows = record_layout_checks.iter().chain(&field_offset_checks);
+            (vec![], vec![], rows.map(LayoutCheck::rs_row).collect_vec())
+        } else {
+            (
+                record_layout_checks.iter().map(LayoutCheck::rs_assertion).collect_vec(),
+                field_offset_checks.iter().map(LayoutCheck::rs_assertion).collect_vec(),
+                vec![],
+            )
+        };
     let assertion_tokens = quote! {
-        const _: () = assert!(::std::mem::size_of::<#qualified_ident>() == #size);
-        const _: () = assert!(::std::mem::align_of::<#qualified_ident>() == #alignment);
+        #( #record_layout_assertions )*
         #( #record_trait_assertions )*
         #( #field_offset_assertions )*
         #( #field_copy_trait_assertions )*
@@ -2416,6 +2830,7 @@ fn generate_record(
         item: record_tokens,
         features,
         assertions: assertion_tokens,
+        layout_checks: quote! { #( #layout_check_rows )* #( #layout_checks_from_record_items )* },
         thunks: thunk_tokens,
         thunk_impls: quote! {#(#thunk_impls_from_record_items __NEWLINE__ __NEWLINE__)*},
     })
@@ -2545,16 +2960,81 @@ fn generate_comment(comment: &Comment) -> Result<GeneratedItem> {
     Ok(quote! { __COMMENT__ #text }.into())
 }
 
+/// The Rust module generated for a C++ namespace, before it is wrapped into a
+/// `pub mod` item.
+struct GeneratedNamespace {
+    /// Name of the module (e.g. `ns` or `ns_0` for a reopened namespace).
+    name: Ident,
+    /// Items inside the module.
+    body: TokenStream,
+    /// Items that need to follow the module (e.g. re-exports of an inline
+    /// namespace).
+    trailing_items: TokenStream,
+    /// Thunks, assertions, and so forth collected from the module's items.
+    /// The `item` field is left empty.
+    details: GeneratedItem,
+}
+
 fn generate_namespace(
     db: &Database,
     namespace: &Namespace,
     errors: &mut dyn ErrorReporting,
 ) -> Result<GeneratedItem> {
+    let GeneratedNamespace { name, body, trailing_items, details } =
+        generate_namespace_module(db, namespace, errors)?;
+    Ok(GeneratedItem {
+        item: quote! {
+            pub mod #name {
+                #body
+            }
+            __NEWLINE__
+            #trailing_items
+        },
+        ..details
+    })
+}
+
+/// Like `generate_namespace`, but moves the body of the namespace module into
+/// a separate file (a shard) under `rs_api_shards_path`.  Returns the
+/// out-of-line module declaration together with the shard's file name and
+/// contents.
+///
+/// The file name only depends on the name of the module, so that a given
+/// namespace always ends up in the same shard and unchanged shards can be
+/// reused by incremental compilation.
+fn generate_namespace_shard(
+    db: &Database,
+    namespace: &Namespace,
+    rs_api_shards_path: &str,
+    errors: &mut dyn ErrorReporting,
+) -> Result<(GeneratedItem, String, TokenStream)> {
+    let GeneratedNamespace { name, body, trailing_items, details } =
+        generate_namespace_module(db, namespace, errors)?;
+    let file_name = format!("{name}.rs");
+    let path = format!("{rs_api_shards_path}/{file_name}");
+    let generated_item = GeneratedItem {
+        item: quote! {
+            #[path = #path]
+            pub mod #name;
+            __NEWLINE__
+            #trailing_items
+        },
+        ..details
+    };
+    Ok((generated_item, file_name, body))
+}
+
+fn generate_namespace_module(
+    db: &Database,
+    namespace: &Namespace,
+    errors: &mut dyn ErrorReporting,
+) -> Result<GeneratedNamespace> {
     let ir = db.ir();
     let mut items = vec![];
     let mut thunks = vec![];
     let mut thunk_impls = vec![];
     let mut assertions = vec![];
+    let mut layout_checks = vec![];
     let mut features = BTreeSet::new();
 
     for item_id in namespace.child_item_ids.iter() {
@@ -2572,6 +3052,9 @@ fn generate_namespace(
         if !generated.assertions.is_empty() {
             assertions.push(generated.assertions);
         }
+        if !generated.layout_checks.is_empty() {
+            layout_checks.push(generated.layout_checks);
+        }
         features.extend(generated.features);
     }
 
@@ -2604,26 +3087,80 @@ fn generate_namespace(
         quote! {}
     };
 
-    let namespace_tokens = quote! {
-        pub mod #name {
+    Ok(GeneratedNamespace {
+        name,
+        body: quote! {
             #use_stmt_for_previous_namespace
 
             #( #items __NEWLINE__ __NEWLINE__ )*
-        }
-        __NEWLINE__
-        #use_stmt_for_inline_namespace
-    };
-
-    Ok(GeneratedItem {
-        item: namespace_tokens,
-        features: features,
-        thunks: quote! { #( #thunks )* },
-        thunk_impls: quote! { #( #thunk_impls )* },
-        assertions: quote! { #( #assertions )* },
-        ..Default::default()
+        },
+        trailing_items: use_stmt_for_inline_namespace,
+        details: GeneratedItem {
+            features: features,
+            thunks: quote! { #( #thunks )* },
+            thunk_impls: quote! { #( #thunk_impls )* },
+            assertions: quote! { #( #assertions )* },
+            layout_checks: quote! { #( #layout_checks )* },
+            ..Default::default()
+        },
     })
 }
 
+/// A layout property of a record (`actual`) and the value that the bindings
+/// rely on (`expected`).
+struct LayoutCheck {
+    actual: TokenStream,
+    expected: Literal,
+}
+
+impl LayoutCheck {
+    /// Formats the check as a standalone Rust assertion.
+    fn rs_assertion(&self) -> TokenStream {
+        let LayoutCheck { actual, expected } = self;
+        quote! { const _: () = assert!(#actual == #expected); }
+    }
+
+    /// Formats the check as a row of the Rust table built by
+    /// `generate_layout_checks_assertion`.
+    fn rs_row(&self) -> TokenStream {
+        let LayoutCheck { actual, expected } = self;
+        quote! { (#actual, #expected), }
+    }
+
+    /// Formats the check as a standalone C++ `static_assert`.
+    fn cc_assertion(&self) -> TokenStream {
+        let LayoutCheck { actual, expected } = self;
+        quote! { static_assert(#actual == #expected); }
+    }
+
+    /// Formats the check as a row of the C++ table built by
+    /// `generate_rs_api_impl`.
+    fn cc_row(&self) -> TokenStream {
+        let LayoutCheck { actual, expected } = self;
+        quote! { {#actual, #expected}, }
+    }
+}
+
+/// Returns a single assertion that checks all the `layout_checks` rows (see
+/// `LayoutCheck::rs_row`) of the current target.
+///
+/// Compared to one `const _: () = assert!(...)` item per check, this gives
+/// `rustc` a single constant to evaluate per target.  The price is a less
+/// precise error message: the failing row is not reported, and bindings
+/// generated without `--compact_layout_assertions` need to be used to find it.
+fn generate_layout_checks_assertion(layout_checks: &[TokenStream]) -> TokenStream {
+    quote! {
+        const _: () = {
+            let checks: &[(usize, usize)] = &[ #( #layout_checks )* ];
+            let mut i = 0;
+            while i < checks.len() {
+                assert!(checks[i].0 == checks[i].1);
+                i += 1;
+            }
+        };
+    }
+}
+
 #[derive(Clone, Debug, Default)]
 struct GeneratedItem {
     item: TokenStream,
@@ -2631,6 +3168,9 @@ struct GeneratedItem {
     // C++ source code for helper functions.
     thunk_impls: TokenStream,
     assertions: TokenStream,
+    // Rows of the per-target layout assertion table (see
+    // `--compact_layout_assertions`), formatted by `LayoutCheck::rs_row`.
+    layout_checks: TokenStream,
     features: BTreeSet<Ident>,
 }
 
@@ -2646,7 +3186,7 @@ impl PartialEq for GeneratedItem {
     fn eq(&self, other: &Self) -> bool {
         fn to_comparable_tuple(
             _x: &GeneratedItem,
-        ) -> (&BTreeSet<Ident>, String, String, String, String) {
+        ) -> (&BTreeSet<Ident>, String, String, String, String, String) {
             // TokenStream doesn't implement `PartialEq`, so we convert to an equivalent
             // `String`. This is a bit expensive, but should be okay (especially
             // given that this code doesn't execute at this point).  Having a
@@ -2668,6 +3208,7 @@ impl PartialEq for GeneratedItem {
                 _x.thunks.to_string(),
                 _x.thunk_impls.to_string(),
                 _x.assertions.to_string(),
+                _x.layout_checks.to_string(),
             )
         }
         to_comparable_tuple(self) == to_comparable_tuple(other)
@@ -2741,6 +3282,7 @@ fn generate_item(
 ///
 /// TODO(b/213280424): Implement support for overloaded functions.
 fn overloaded_funcs(db: &dyn BindingsGenerator) -> Rc<HashSet<Rc<FunctionId>>> {
+    let _scope = profile_scope("BindingsGenerator::overloaded_funcs");
     let mut seen_funcs = HashSet::new();
     let mut overloaded_funcs = HashSet::new();
     for func in db.ir().functions() {
@@ -2756,18 +3298,27 @@ fn overloaded_funcs(db: &dyn BindingsGenerator) -> Rc<HashSet<Rc<FunctionId>>> {
 
 // Returns the Rust code implementing bindings, plus any auxiliary C++ code
 // needed to support it.
+//
+// If `rs_api_shards_path` is specified, then each top-level namespace module is
+// moved into a separate shard and `rs_api` only declares it via
+// `#[path = "<rs_api_shards_path>/<module>.rs"] pub mod <module>;`.
 fn generate_bindings_tokens(
     ir: Rc<IR>,
     crubit_support_path: &str,
+    rs_api_shards_path: Option<&str>,
+    compact_layout_assertions: bool,
     errors: &mut dyn ErrorReporting,
 ) -> Result<BindingsTokens> {
     let mut db = Database::default();
     db.set_ir(ir.clone());
+    db.set_compact_layout_assertions(compact_layout_assertions);
 
     let mut items = vec![];
     let mut thunks = vec![];
     let mut thunk_impls = vec![generate_rs_api_impl(&mut db, crubit_support_path)?];
     let mut assertions = vec![];
+    let mut layout_checks = vec![];
+    let mut rs_api_shards = BTreeMap::new();
 
     // We import nullable pointers as an Option<&T> and assume that at the ABI
     // level, None is represented as a zero pointer value whereas Some is
@@ -2786,7 +3337,17 @@ fn generate_bindings_tokens(
     for top_level_item_id in ir.top_level_item_ids() {
         let item =
             ir.find_decl(*top_level_item_id).context("Failed to look up ir.top_level_item_ids")?;
-        let generated = generate_item(&db, item, errors)?;
+        let generated = match (item, rs_api_shards_path) {
+            (Item::Namespace(namespace), Some(rs_api_shards_path))
+                if ir.is_current_target(&namespace.owning_target) =>
+            {
+                let (generated, file_name, shard) =
+                    generate_namespace_shard(&db, namespace, rs_api_shards_path, errors)?;
+                rs_api_shards.insert(file_name, shard);
+                generated
+            }
+            _ => generate_item(&db, item, errors)?,
+        };
         items.push(generated.item);
         if !generated.thunks.is_empty() {
             thunks.push(generated.thunks);
@@ -2794,11 +3355,21 @@ fn generate_bindings_tokens(
         if !generated.assertions.is_empty() {
             assertions.push(generated.assertions);
         }
+        if !generated.layout_checks.is_empty() {
+            layout_checks.push(generated.layout_checks);
+        }
         if !generated.thunk_impls.is_empty() {
             thunk_impls.push(generated.thunk_impls);
         }
         features.extend(generated.features);
     }
+    if !layout_checks.is_empty() {
+        assertions.push(generate_layout_checks_assertion(&layout_checks));
+    }
+    for mapped_type in slice_view_types(&ir)?.into_values() {
+        let rs_view = db.rs_type_kind(mapped_type.rs_type.clone())?;
+        assertions.push(rs_slice_view_assertions(&rs_view));
+    }
 
     let mod_detail = if thunks.is_empty() {
         quote! {}
@@ -2838,6 +3409,7 @@ fn generate_bindings_tokens(
             #( #assertions __NEWLINE__ __NEWLINE__ )*
         },
         rs_api_impl: quote! {#(#thunk_impls  __NEWLINE__ __NEWLINE__ )*},
+        rs_api_shards,
     })
 }
 
@@ -2995,6 +3567,12 @@ enum RsTypeKind {
         underlying_type: Rc<RsTypeKind>,
         crate_path: Rc<CratePath>,
     },
+    /// A contiguous view (e.g. `absl::Span<T>`), represented as a
+    /// `::slice_ref::SliceRef<T>` or `::slice_ref::SliceMut<T>`.
+    Slice {
+        element_type: Rc<RsTypeKind>,
+        mutability: Mutability,
+    },
     Unit,
     Other {
         name: Rc<str>,
@@ -3131,6 +3709,7 @@ impl RsTypeKind {
             RsTypeKind::IncompleteRecord { .. } => false,
             RsTypeKind::Record { record, .. } => should_derive_copy(record),
             RsTypeKind::TypeAlias { underlying_type, .. } => underlying_type.implements_copy(),
+            RsTypeKind::Slice { .. } => true,
             RsTypeKind::Other { type_args, .. } => {
                 // All types that may appear here without `type_args` (e.g.
                 // primitive types like `i32`) implement `Copy`. Generic types
@@ -3315,6 +3894,10 @@ impl ToTokens for RsTypeKind {
                 let ident = make_rs_ident(&type_alias.identifier.identifier);
                 quote! { #crate_path #ident }
             }
+            RsTypeKind::Slice { element_type, mutability } => match mutability {
+                Mutability::Const => quote! {::slice_ref::SliceRef<#element_type>},
+                Mutability::Mut => quote! {::slice_ref::SliceMut<#element_type>},
+            },
             // This doesn't affect void in function return values, as those are special-cased to be
             // omitted.
             RsTypeKind::Unit => quote! {::std::os::raw::c_void},
@@ -3353,6 +3936,7 @@ impl<'ty> Iterator for RsTypeKindIter<'ty> {
                     RsTypeKind::Reference { referent, .. } => self.todo.push(referent),
                     RsTypeKind::RvalueReference { referent, .. } => self.todo.push(referent),
                     RsTypeKind::TypeAlias { underlying_type: t, .. } => self.todo.push(t),
+                    RsTypeKind::Slice { element_type, .. } => self.todo.push(element_type),
                     RsTypeKind::FuncPtr { return_type, param_types, .. } => {
                         self.todo.push(return_type);
                         self.todo.extend(param_types.iter().rev());
@@ -3376,6 +3960,7 @@ fn unique_lifetimes<'a>(
 }
 
 fn rs_type_kind(db: &dyn BindingsGenerator, ty: ir::RsType) -> Result<RsTypeKind> {
+    let _scope = profile_scope("BindingsGenerator::rs_type_kind");
     let ir = db.ir();
     // The lambdas deduplicate code needed by multiple `match` branches.
     let get_type_args = || -> Result<Vec<RsTypeKind>> {
@@ -3467,6 +4052,12 @@ fn rs_type_kind(db: &dyn BindingsGenerator, ty: ir::RsType) -> Result<RsTypeKind
                 mutability: Mutability::Const,
                 lifetime: get_lifetime()?,
             },
+            "#Slice mut" => {
+                RsTypeKind::Slice { element_type: get_pointee()?, mutability: Mutability::Mut }
+            }
+            "#Slice const" => {
+                RsTypeKind::Slice { element_type: get_pointee()?, mutability: Mutability::Const }
+            }
             name => {
                 let mut type_args = get_type_args()?;
                 match name.strip_prefix("#funcPtr ") {
@@ -3623,16 +4214,61 @@ fn format_cc_type_inner(ty: &ir::CcType, ir: &IR, references_ok: bool) -> Result
     }
 }
 
-fn cc_struct_layout_assertion(record: &Record, ir: &IR) -> Result<TokenStream> {
+/// Returns the contiguous views (see `RsTypeKind::Slice`) that the functions of
+/// the current target take or return by value, keyed by their C++ spelling.
+fn slice_view_types(ir: &IR) -> Result<BTreeMap<String, &MappedType>> {
+    let mut views = BTreeMap::new();
+    for func in ir.functions().filter(|func| ir.is_current_target(&func.owning_target)) {
+        let types = func.params.iter().map(|p| &p.type_).chain(iter::once(&func.return_type));
+        for mapped_type in types {
+            if matches!(mapped_type.rs_type.name.as_deref(), Some("#Slice const" | "#Slice mut")) {
+                let cc_type = format_cc_type(&mapped_type.cc_type, ir)?;
+                views.insert(cc_type.to_string(), mapped_type);
+            }
+        }
+    }
+    Ok(views)
+}
+
+/// Returns the C++ assertions that `cc_view` has the layout of
+/// `::slice_ref::SliceRef` and `::slice_ref::SliceMut`: a pointer followed by a
+/// `size_t`, passed by value in registers.
+///
+/// The members of the views are private, so their offsets can't be checked
+/// here; `Importer::ConvertContiguousViewType` only maps views whose first
+/// member is the pointer and second member is the length.
+fn cc_slice_view_assertions(cc_view: &TokenStream) -> TokenStream {
+    quote! {
+        static_assert(sizeof(#cc_view) == 2 * sizeof(std::size_t));
+        static_assert(alignof(#cc_view) == alignof(std::size_t));
+        static_assert(std::is_trivially_copyable_v<#cc_view>);
+    }
+}
+
+/// Returns the Rust assertions that `rs_view` (a `::slice_ref::SliceRef` or
+/// `::slice_ref::SliceMut`) has the same layout as the C++ view checked by
+/// `cc_slice_view_assertions`.
+fn rs_slice_view_assertions(rs_view: &RsTypeKind) -> TokenStream {
+    quote! {
+        const _: () = assert!(
+            ::std::mem::size_of::<#rs_view>() == 2 * ::std::mem::size_of::<usize>());
+        const _: () = assert!(
+            ::std::mem::align_of::<#rs_view>() == ::std::mem::align_of::<usize>());
+    }
+}
+
+/// Returns the layout properties of `record` that the C++ side needs to verify
+/// (or nothing if `record` belongs to another target).
+fn cc_struct_layout_checks(record: &Record, ir: &IR) -> Result<Vec<LayoutCheck>> {
     if !ir.is_current_target(&record.owning_target) {
-        return Ok(quote! {});
+        return Ok(vec![]);
     }
     let record_ident = format_cc_ident(record.cc_name.as_ref());
     let namespace_qualifier = namespace_qualifier_of_item(record.id, ir)?.format_for_cc()?;
     let cc_size = Literal::usize_unsuffixed(record.original_cc_size);
     let alignment = Literal::usize_unsuffixed(record.alignment);
     let tag_kind = cc_tag_kind(record);
-    let field_assertions = record
+    let field_checks = record
         .fields
         .iter()
         .filter(|f| f.access == AccessSpecifier::Public && f.identifier.is_some())
@@ -3653,13 +4289,21 @@ fn cc_struct_layout_assertion(record: &Record, ir: &IR) -> Result<TokenStream> {
                 CRUBIT_OFFSET_OF(#field_ident, #tag_kind #namespace_qualifier #record_ident)
             };
 
-            quote! { static_assert( #actual_offset == #expected_offset); }
+            LayoutCheck { actual: actual_offset, expected: expected_offset }
         });
-    Ok(quote! {
-        static_assert(sizeof(#tag_kind #namespace_qualifier #record_ident) == #cc_size);
-        static_assert(alignof(#tag_kind #namespace_qualifier #record_ident) == #alignment);
-        #( #field_assertions )*
-    })
+    Ok([
+        LayoutCheck {
+            actual: quote! { sizeof(#tag_kind #namespace_qualifier #record_ident) },
+            expected: cc_size,
+        },
+        LayoutCheck {
+            actual: quote! { alignof(#tag_kind #namespace_qualifier #record_ident) },
+            expected: alignment,
+        },
+    ]
+    .into_iter()
+    .chain(field_checks)
+    .collect())
 }
 
 // Returns the accessor functions for no_unique_address member variables.
@@ -3702,6 +4346,113 @@ fn cc_struct_no_unique_address_impl(db: &Database, record: &Record) -> Result<To
     })
 }
 
+/// Returns the implementations of `::ctor::ConstructN`, `::ctor::DestroyN`, and
+/// `::ctor::MoveConstructN` for records annotated with
+/// `[[clang::annotate("crubit_bulk_thunks")]]`.
+///
+/// Each of them is backed by a single C++ thunk that loops over the whole
+/// array, so that e.g. default-constructing a `::ctor::PinnedArray` of `n`
+/// objects crosses the language boundary once rather than `n` times.
+fn cc_struct_bulk_thunks_impl(db: &Database, record: &Rc<Record>) -> Result<GeneratedItem> {
+    // `Unpin` records are constructed and moved by value in Rust.
+    if !record.has_bulk_thunks || record.is_unpin() || record.is_abstract {
+        return Ok(GeneratedItem::default());
+    }
+    let ir = db.ir();
+    // Only offer `ConstructN` if the default constructor itself gets bindings,
+    // i.e. if it is imported as `CtorNew<()>`.
+    let has_default_constructor = ir
+        .functions()
+        .filter(|func| {
+            func.name == UnqualifiedIdentifier::Constructor
+                && func.member_func_metadata.as_ref().map(|meta| meta.record_id) == Some(record.id)
+        })
+        .any(|func| {
+            let mut param_types = func
+                .params
+                .iter()
+                .map(|param| db.rs_type_kind(param.type_.rs_type.clone()))
+                .collect::<Result<Vec<_>>>()
+                .unwrap_or_default();
+            matches!(
+                api_func_shape(db, func, &mut param_types),
+                Ok(Some((_, ImplKind::Trait { trait_name: TraitName::CtorNew(params), .. })))
+                    if params.is_empty()
+            )
+        });
+
+    let rs_name = RsTypeKind::new_record(record.clone(), &ir)?.into_token_stream();
+    let cc_name = cc_type_name_for_record(record.as_ref(), &ir)?;
+    let crate_root_path = crate_root_path_tokens(&ir);
+    let mut impls = vec![];
+    let mut thunks = vec![];
+    let mut cc_impls = vec![];
+    let mut add_bulk_thunk =
+        |trait_name: &str, method_name: &str, cc_loop_body: TokenStream, has_src: bool| {
+            let trait_ident = make_rs_ident(trait_name);
+            let method_ident = make_rs_ident(method_name);
+            let thunk_ident =
+                make_rs_ident(&format!("__crubit_{}__{}", method_name, record.mangled_cc_name));
+            let (rs_src_param, rs_src_arg, thunk_src_param, cc_src_param) = if has_src {
+                (
+                    quote! { src: *mut Self, },
+                    quote! { src, },
+                    quote! { src: *mut #rs_name, },
+                    quote! { #cc_name* src, },
+                )
+            } else {
+                (quote! {}, quote! {}, quote! {}, quote! {})
+            };
+            impls.push(quote! {
+                unsafe impl ::ctor::#trait_ident for #rs_name {
+                    #[inline(always)]
+                    unsafe fn #method_ident(dest: *mut Self, #rs_src_param n: usize) {
+                        #crate_root_path::detail::#thunk_ident(dest, #rs_src_arg n)
+                    }
+                }
+            });
+            thunks.push(quote! {
+                pub(crate) fn #thunk_ident(dest: *mut #rs_name, #thunk_src_param n: usize);
+            });
+            // The thunks are `inline` so that the linker deduplicates them when
+            // multiple targets generate them for the same class template instantiation.
+            cc_impls.push(quote! {
+                extern "C" inline __attribute__((used)) void #thunk_ident(
+                    #cc_name* dest, #cc_src_param std::size_t n) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        #cc_loop_body;
+                    }
+                }
+            });
+        };
+    if has_default_constructor {
+        add_bulk_thunk(
+            "ConstructN",
+            "construct_n",
+            quote! { crubit::construct_at(dest + i) },
+            false,
+        );
+    }
+    if record.move_constructor != SpecialMemberFunc::Unavailable {
+        add_bulk_thunk(
+            "MoveConstructN",
+            "move_construct_n",
+            quote! { crubit::construct_at(dest + i, std::move(src[i])) },
+            true,
+        );
+    }
+    if record.destructor != SpecialMemberFunc::Unavailable {
+        add_bulk_thunk("DestroyN", "destroy_n", quote! { std::destroy_at(dest + i) }, false);
+    }
+
+    Ok(GeneratedItem {
+        item: quote! {#(#impls)*},
+        thunks: quote! {#(#thunks)*},
+        thunk_impls: quote! {#(#cc_impls)*},
+        ..Default::default()
+    })
+}
+
 fn crate_root_path_tokens(ir: &IR) -> TokenStream {
     match ir.crate_root_path().as_deref().map(make_rs_ident) {
         None => quote! { crate },
@@ -3777,7 +4528,7 @@ fn generate_rs_api_impl(db: &mut Database, crubit_support_path: &str) -> Result<
     let mut thunks = vec![];
     let ir = db.ir();
     for func in ir.functions() {
-        if can_skip_cc_thunk(db, func) {
+        if can_skip_cc_thunk(db, func) || has_inline_rs_body(db, func) {
             continue;
         }
         match db.generate_func(func.clone()).unwrap_or_default() {
@@ -3943,28 +4694,75 @@ fn generate_rs_api_impl(db: &mut Database, crubit_support_path: &str) -> Result<
             }
         };
 
+        // Thunks for members of class template instantiations are emitted by every
+        // target that uses the instantiation. Making them `inline` gives them vague
+        // (COMDAT) linkage, so that the linker keeps a single copy, and `used` makes
+        // sure that they are emitted even though nothing in C++ calls them.
+        let linkage = if func.is_member_or_descendant_of_class_template {
+            quote! { inline __attribute__((used)) }
+        } else {
+            quote! {}
+        };
         thunks.push(quote! {
-            extern "C" #return_type_name #thunk_ident( #( #param_types #param_idents ),* ) {
+            extern "C" #linkage #return_type_name #thunk_ident(
+                #( #param_types #param_idents ),* ) {
                 #return_stmt;
             }
         });
     }
 
-    let layout_assertions = ir
+    let layout_checks = ir
         .records()
-        .map(|record| cc_struct_layout_assertion(record, &ir))
+        .map(|record| cc_struct_layout_checks(record, &ir))
         .collect::<Result<Vec<_>>>()?;
-
-    let mut internal_includes = BTreeSet::new();
-    internal_includes.insert(CcInclude::memory()); // ubiquitous.
-    if ir.records().next().is_some() {
-        internal_includes.insert(CcInclude::cstddef());
+    let compact_layout_assertions = db.compact_layout_assertions();
+    let layout_assertions = if !compact_layout_assertions {
+        layout_checks
+            .iter()
+            .map(|checks| {
+                let assertions = checks.iter().map(LayoutCheck::cc_assertion);
+                quote! { #( #assertions )* }
+            })
+            .collect_vec()
+    } else if layout_checks.iter().all(Vec::is_empty) {
+        vec![]
+    } else {
+        // A single `static_assert` over a table of all the checks of the current
+        // target - see `support/internal/layout_assertions.h`.
+        let rows = layout_checks.iter().flatten().map(LayoutCheck::cc_row);
+        vec![quote! {
+            constexpr ::crubit::details::LayoutCheck __crubit_layout_checks[] = { #( #rows )* };
+            static_assert(
+                ::crubit::details::FirstFailedLayoutCheck(__crubit_layout_checks) ==
+                ::crubit::details::LayoutCheckCount(__crubit_layout_checks));
+        }]
+    };
+
+    // Views are passed by value as `::slice_ref::SliceRef` / `SliceMut`, so (like
+    // records) their layout needs to be verified.
+    let slice_views = slice_view_types(&ir)?;
+    let slice_view_assertions = slice_views
+        .values()
+        .map(|mapped_type| {
+            Ok(cc_slice_view_assertions(&format_cc_type(&mapped_type.cc_type, &ir)?))
+        })
+        .collect::<Result<Vec<_>>>()?;
+
+    let mut internal_includes = BTreeSet::new();
+    internal_includes.insert(CcInclude::memory()); // ubiquitous.
+    if ir.records().next().is_some() || !slice_views.is_empty() {
+        internal_includes.insert(CcInclude::cstddef());
     };
     for crubit_header in ["internal/cxx20_backports.h", "internal/offsetof.h"] {
         internal_includes.insert(CcInclude::user_header(
             format!("{crubit_support_path}/{crubit_header}").into(),
         ));
     }
+    if compact_layout_assertions {
+        internal_includes.insert(CcInclude::user_header(
+            format!("{crubit_support_path}/internal/layout_assertions.h").into(),
+        ));
+    }
     let internal_includes = format_cc_includes(&internal_includes);
 
     // In order to generate C++ thunk in all the cases Clang needs to be able to
@@ -3989,6 +4787,8 @@ fn generate_rs_api_impl(db: &mut Database, crubit_support_path: &str) -> Result<
 
         #( #layout_assertions __NEWLINE__ __NEWLINE__ )*
 
+        #( #slice_view_assertions __NEWLINE__ __NEWLINE__ )*
+
         __NEWLINE__
         __HASH_TOKEN__ pragma clang diagnostic pop __NEWLINE__
         // To satisfy http://cs/symbol:devtools.metadata.Presubmit.CheckTerminatingNewline check.
@@ -4011,12 +4811,41 @@ mod tests {
     use token_stream_printer::rs_tokens_to_formatted_string_for_tests;
 
     fn generate_bindings_tokens(ir: Rc<IR>) -> Result<BindingsTokens> {
-        super::generate_bindings_tokens(ir, "crubit/rs_bindings_support", &mut IgnoreErrors)
+        super::generate_bindings_tokens(
+            ir,
+            "crubit/rs_bindings_support",
+            None,
+            /* compact_layout_assertions= */ false,
+            &mut IgnoreErrors,
+        )
+    }
+
+    fn generate_sharded_bindings_tokens(ir: Rc<IR>) -> Result<BindingsTokens> {
+        super::generate_bindings_tokens(
+            ir,
+            "crubit/rs_bindings_support",
+            Some("rs_api_shards"),
+            /* compact_layout_assertions= */ false,
+            &mut IgnoreErrors,
+        )
+    }
+
+    fn generate_bindings_tokens_with_compact_layout_assertions(
+        ir: Rc<IR>,
+    ) -> Result<BindingsTokens> {
+        super::generate_bindings_tokens(
+            ir,
+            "crubit/rs_bindings_support",
+            None,
+            /* compact_layout_assertions= */ true,
+            &mut IgnoreErrors,
+        )
     }
 
     fn db_from_cc(cc_src: &str) -> Result<Database> {
         let mut db = Database::default();
         db.set_ir(ir_from_cc(cc_src)?);
+        db.set_compact_layout_assertions(false);
         Ok(db)
     }
 
@@ -4055,7 +4884,7 @@ mod tests {
     #[test]
     fn test_simple_function() -> Result<()> {
         let ir = ir_from_cc("int Add(int a, int b);")?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4087,7 +4916,7 @@ mod tests {
     #[test]
     fn test_inline_function() -> Result<()> {
         let ir = ir_from_cc("inline int Add(int a, int b);")?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4128,7 +4957,7 @@ mod tests {
             "struct ReturnStruct final {}; struct ParamStruct final {};",
         )?;
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4179,7 +5008,7 @@ mod tests {
             ir_from_cc_dependency(current_target_src, dependency_src)?
         };
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4196,7 +5025,7 @@ mod tests {
                     #[doc = " Generated from: google3/test/dependency_header.h;l=4"]
                     #[inline(always)]
                     pub fn GetValue<'a>(self: ... Pin<&'a mut Self>) -> i32 { unsafe {
-                        crate::detail::__rust_thunk___ZN10MyTemplateIiE8GetValueEv__2f_2ftest_3atesting_5ftarget(
+                        crate::detail::__rust_thunk___ZN10MyTemplateIiE8GetValueEv(
                             self)
                     }}
                 }
@@ -4214,7 +5043,7 @@ mod tests {
                 mod detail { ...  extern "C" {
                     ...
                     pub(crate) fn
-                    __rust_thunk___ZN10MyTemplateIiE8GetValueEv__2f_2ftest_3atesting_5ftarget<'a>(
+                    __rust_thunk___ZN10MyTemplateIiE8GetValueEv<'a>(
                         __this: ... Pin<&'a mut crate::__CcTemplateInst10MyTemplateIiE>
                     ) -> i32;
                     ...
@@ -4224,8 +5053,8 @@ mod tests {
         assert_cc_matches!(
             rs_api_impl,
             quote! {
-                extern "C"
-                int __rust_thunk___ZN10MyTemplateIiE8GetValueEv__2f_2ftest_3atesting_5ftarget(
+                extern "C" inline __attribute__((used))
+                int __rust_thunk___ZN10MyTemplateIiE8GetValueEv(
                         struct MyTemplate<int>* __this) {
                     return __this->GetValue();
                 }
@@ -4271,8 +5100,8 @@ mod tests {
         assert_cc_matches!(
             rs_api_impl,
             quote! {
-                extern "C" class MyTemplate<int>
-                __rust_thunk___ZN10MyTemplateIiE6CreateEi__2f_2ftest_3atesting_5ftarget(
+                extern "C" inline __attribute__((used)) class MyTemplate<int>
+                __rust_thunk___ZN10MyTemplateIiE6CreateEi(
                         int value) {
                     return MyTemplate<int>::Create(value);
                 }
@@ -4281,8 +5110,8 @@ mod tests {
         assert_cc_matches!(
             rs_api_impl,
             quote! {
-                extern "C" int const*
-                __rust_thunk___ZNK10MyTemplateIiE5valueEv__2f_2ftest_3atesting_5ftarget(
+                extern "C" inline __attribute__((used)) int const*
+                __rust_thunk___ZNK10MyTemplateIiE5valueEv(
                         const class MyTemplate<int>*__this) {
                     return &__this->value();
                 }
@@ -4307,7 +5136,7 @@ mod tests {
         "#,
         )?;
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4355,6 +5184,89 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_compact_layout_assertions() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"
+            struct SomeStruct final {
+                int first;
+                char second;
+            };
+            namespace ns {
+            struct OtherStruct final {
+                long long field;
+            };
+            }  // namespace ns
+        "#,
+        )?;
+
+        let BindingsTokens { rs_api, rs_api_impl, .. } =
+            generate_bindings_tokens_with_compact_layout_assertions(ir)?;
+        assert_rs_not_matches!(
+            rs_api,
+            quote! { const _: () = assert!(::std::mem::size_of::<crate::SomeStruct>() == 8); }
+        );
+        assert_rs_not_matches!(
+            rs_api,
+            quote! { const _: () = assert!(memoffset::offset_of!(crate::SomeStruct, first) == 0); }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                const _: () = {
+                    let checks: &[(usize, usize)] = &[
+                        (::std::mem::size_of::<crate::SomeStruct>(), 8),
+                        (::std::mem::align_of::<crate::SomeStruct>(), 4),
+                        (memoffset::offset_of!(crate::SomeStruct, first), 0),
+                        (memoffset::offset_of!(crate::SomeStruct, second), 4),
+                        (::std::mem::size_of::<crate::ns::OtherStruct>(), 8),
+                        (::std::mem::align_of::<crate::ns::OtherStruct>(), 8),
+                        (memoffset::offset_of!(crate::ns::OtherStruct, field), 0),
+                    ];
+                    let mut i = 0;
+                    while i < checks.len() {
+                        assert!(checks[i].0 == checks[i].1);
+                        i += 1;
+                    }
+                };
+            }
+        );
+        // Trait assertions are not affected.
+        assert_rs_matches!(
+            rs_api,
+            quote! { const _: () = { static_assertions::assert_impl_all!(crate::SomeStruct: Copy); }; }
+        );
+
+        assert_cc_not_matches!(
+            rs_api_impl,
+            quote! { static_assert(sizeof(struct SomeStruct) == 8); }
+        );
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                __HASH_TOKEN__ include "crubit/rs_bindings_support/internal/layout_assertions.h"
+            }
+        );
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                constexpr ::crubit::details::LayoutCheck __crubit_layout_checks[] = {
+                    {sizeof(struct SomeStruct), 8},
+                    {alignof(struct SomeStruct), 4},
+                    {CRUBIT_OFFSET_OF(first, struct SomeStruct), 0},
+                    {CRUBIT_OFFSET_OF(second, struct SomeStruct), 4},
+                    {sizeof(struct ns::OtherStruct), 8},
+                    {alignof(struct ns::OtherStruct), 8},
+                    {CRUBIT_OFFSET_OF(field, struct ns::OtherStruct), 0},
+                };
+                static_assert(
+                    ::crubit::details::FirstFailedLayoutCheck(__crubit_layout_checks) ==
+                    ::crubit::details::LayoutCheckCount(__crubit_layout_checks));
+            }
+        );
+        Ok(())
+    }
+
     #[test]
     fn test_struct_vs_class() -> Result<()> {
         let ir = ir_from_cc(
@@ -4371,7 +5283,7 @@ mod tests {
             };
         "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
 
         // A Rust `struct` is generated for both `SomeStruct` and `SomeClass`.
         assert_rs_matches!(rs_api, quote! { pub struct SomeStruct },);
@@ -4399,7 +5311,7 @@ mod tests {
             } SomeAnonStruct __attribute__((aligned(16)));
         "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
 
         // A `struct` is generated for both `SomeStruct` and `SomeAnonStruct`, both
         // in Rust and in C++.
@@ -4446,10 +5358,13 @@ mod tests {
             struct SomeStruct final {
               typedef int Type;
             };
-            inline SomeStruct::Type Function() {return 0;}
+            inline SomeStruct::Type Function() {
+              SomeStruct::Type result = 0;
+              return result;
+            }
         "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         // TODO(b/200067824): This should use the alias's real name in Rust, as well.
         assert_rs_matches!(rs_api, quote! { pub fn Function() -> i32 { ... } },);
 
@@ -4512,7 +5427,10 @@ mod tests {
         let ir = ir_from_cc(
             r#"
             struct SomeStruct {
-                static inline int some_func() { return 42; }
+                static inline int some_func() {
+                    int result = 42;
+                    return result;
+                }
             }; "#,
         )?;
 
@@ -4532,7 +5450,10 @@ mod tests {
         let ir = ir_from_cc(
             r#"
             struct SomeStruct {
-                inline int some_func(int arg) const { return 42 + arg; }
+                inline int some_func(int arg) const {
+                    int result = 42 + arg;
+                    return result;
+                }
             }; "#,
         )?;
 
@@ -4548,6 +5469,80 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_trivial_inline_functions_are_implemented_in_rust() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"
+            #pragma clang lifetime_elision
+            inline int Add(int a, int b) { return a + b; }
+            constexpr bool IsPositive(long x) { return x > 0; }
+            inline short AddNarrow(short a, short b) { return a + b; }
+            struct SomeStruct final {
+                int GetPublic() const { return public_field; }
+                unsigned GetPrivate() const { return 2 * private_field; }
+                int public_field;
+              private:
+                unsigned private_field;
+            }; "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub fn Add(a: i32, b: i32) -> i32 {
+                    a.wrapping_add(b)
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub fn IsPositive(x: i64) -> bool {
+                    x > 0i64
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub fn GetPublic<'a>(&'a self) -> i32 {
+                    self.public_field
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub fn GetPrivate<'a>(&'a self) -> u32 {
+                    2u32.wrapping_mul(unsafe {
+                        ::std::ptr::addr_of!(self.private_field).cast::<u32>().read()
+                    })
+                }
+            }
+        );
+        for thunk in [
+            quote! { __rust_thunk___Z3Addii },
+            quote! { __rust_thunk___Z10IsPositivel },
+            quote! { __rust_thunk___ZNK10SomeStruct9GetPublicEv },
+            quote! { __rust_thunk___ZNK10SomeStruct10GetPrivateEv },
+        ] {
+            assert_rs_not_matches!(rs_api, thunk);
+            assert_cc_not_matches!(rs_api_impl, thunk);
+        }
+
+        // `short` is promoted to `int` by C++ arithmetic, so `AddNarrow` still needs a thunk.
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub fn AddNarrow(a: i16, b: i16) -> i16 {
+                    unsafe { crate::detail::__rust_thunk___Z9AddNarrowss(a, b) }
+                }
+            }
+        );
+        assert_cc_matches!(rs_api_impl, quote! { __rust_thunk___Z9AddNarrowss });
+        Ok(())
+    }
+
     #[test]
     fn test_record_with_unsupported_field_type() -> Result<()> {
         // Using a nested struct because it's currently not supported.
@@ -4828,7 +5823,7 @@ mod tests {
     #[test]
     fn test_struct_from_other_target() -> Result<()> {
         let ir = ir_from_cc_dependency("// intentionally empty", "struct SomeStruct {};")?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_not_matches!(rs_api, quote! { SomeStruct });
         assert_cc_not_matches!(rs_api_impl, quote! { SomeStruct });
         Ok(())
@@ -4897,7 +5892,7 @@ mod tests {
     fn test_ptr_func() -> Result<()> {
         let ir = ir_from_cc(r#" inline int* Deref(int*const* p); "#)?;
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4940,7 +5935,7 @@ mod tests {
         // generate a thunk for it (where we then process the CcType).
         let ir = ir_from_cc(r#" inline void f(const char *str); "#)?;
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -4968,10 +5963,223 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_span_params_map_to_slices() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"
+            namespace absl {
+            template <typename T>
+            class Span {
+              T* ptr_;
+              decltype(sizeof(0)) len_;
+            };
+            }  // namespace absl
+
+            float Sum(absl::Span<const float> values);
+            void Fill(absl::Span<int> values, int value);
+            "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[inline(always)]
+                pub unsafe fn Sum(values: ::slice_ref::SliceRef<f32>) -> f32 {
+                    crate::detail::__rust_thunk___Z3SumN4absl4SpanIKfEE(values)
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[inline(always)]
+                pub unsafe fn Fill(values: ::slice_ref::SliceMut<i32>, value: i32) {
+                    crate::detail::__rust_thunk___Z4FillN4absl4SpanIiEEi(values, value)
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[link_name = "_Z3SumN4absl4SpanIKfEE"]
+                pub(crate) fn __rust_thunk___Z3SumN4absl4SpanIKfEE(
+                    values: ::slice_ref::SliceRef<f32>) -> f32;
+            }
+        );
+        // The view is passed through as-is: there is no C++ thunk, and no
+        // bindings for the `absl::Span` instantiations themselves.
+        assert_cc_not_matches!(rs_api_impl, quote! { __rust_thunk___Z3SumN4absl4SpanIKfEE });
+        assert_rs_not_matches!(rs_api, quote! { __CcTemplateInstN4absl4SpanIKfEE });
+        // Both sides verify that the views have the layout of a pointer and a
+        // length.
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                static_assert(sizeof(absl::Span<const float>) == 2 * sizeof(std::size_t));
+                static_assert(alignof(absl::Span<const float>) == alignof(std::size_t));
+            }
+        );
+        assert_cc_matches!(rs_api_impl, quote! { std::is_trivially_copyable_v });
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! { static_assert(sizeof(absl::Span<int>) == 2 * sizeof(std::size_t)); }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                const _: () = assert!(
+                    ::std::mem::size_of::<::slice_ref::SliceRef<f32>>()
+                        == 2 * ::std::mem::size_of::<usize>());
+                const _: () = assert!(
+                    ::std::mem::align_of::<::slice_ref::SliceRef<f32>>()
+                        == ::std::mem::align_of::<usize>());
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                const _: () = assert!(
+                    ::std::mem::size_of::<::slice_ref::SliceMut<i32>>()
+                        == 2 * ::std::mem::size_of::<usize>());
+            }
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn test_span_with_other_layout_is_not_a_slice() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"
+            namespace absl {
+            template <typename T>
+            class Span {
+              decltype(sizeof(0)) len_;
+              T* ptr_;
+            };
+            }  // namespace absl
+
+            float Sum(absl::Span<const float> values);
+            "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_not_matches!(rs_api, quote! { ::slice_ref::SliceRef });
+        assert_cc_not_matches!(rs_api_impl, quote! { 2 * sizeof(std::size_t) });
+        Ok(())
+    }
+
+    #[test]
+    fn test_bulk_thunks() -> Result<()> {
+        let ir = ir_from_cc(
+            r#" #pragma clang lifetime_elision
+            struct [[clang::annotate("crubit_bulk_thunks")]] Nontrivial {
+              Nontrivial();
+              Nontrivial(Nontrivial&&);
+              ~Nontrivial();
+              int field;
+            };
+            struct NotAnnotated {
+              NotAnnotated();
+              NotAnnotated(NotAnnotated&&);
+              ~NotAnnotated();
+              int field;
+            };
+            struct [[clang::annotate("crubit_bulk_thunks")]] Trivial final {
+              int field;
+            }; "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                unsafe impl ::ctor::ConstructN for crate::Nontrivial {
+                    #[inline(always)]
+                    unsafe fn construct_n(dest: *mut Self, n: usize) {
+                        crate::detail::__crubit_construct_n__10Nontrivial(dest, n)
+                    }
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                unsafe impl ::ctor::MoveConstructN for crate::Nontrivial {
+                    #[inline(always)]
+                    unsafe fn move_construct_n(dest: *mut Self, src: *mut Self, n: usize) {
+                        crate::detail::__crubit_move_construct_n__10Nontrivial(dest, src, n)
+                    }
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                pub(crate) fn __crubit_destroy_n__10Nontrivial(
+                    dest: *mut crate::Nontrivial, n: usize);
+            }
+        );
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" inline __attribute__((used)) void __crubit_construct_n__10Nontrivial(
+                    struct Nontrivial* dest, std::size_t n) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        crubit::construct_at(dest + i);
+                    }
+                }
+            }
+        );
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" inline __attribute__((used)) void __crubit_move_construct_n__10Nontrivial(
+                    struct Nontrivial* dest, struct Nontrivial* src, std::size_t n) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        crubit::construct_at(dest + i, std::move(src[i]));
+                    }
+                }
+            }
+        );
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" inline __attribute__((used)) void __crubit_destroy_n__10Nontrivial(
+                    struct Nontrivial* dest, std::size_t n) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        std::destroy_at(dest + i);
+                    }
+                }
+            }
+        );
+        // Bulk thunks are opt-in, and not needed for `Unpin` records.
+        assert_rs_not_matches!(rs_api, quote! { __crubit_construct_n__12NotAnnotated });
+        assert_rs_not_matches!(rs_api, quote! { __crubit_construct_n__7Trivial });
+        assert_cc_not_matches!(rs_api_impl, quote! { __crubit_construct_n__12NotAnnotated });
+        Ok(())
+    }
+
+    #[test]
+    fn test_bulk_thunks_without_default_constructor() -> Result<()> {
+        let ir = ir_from_cc(
+            r#" #pragma clang lifetime_elision
+            struct [[clang::annotate("crubit_bulk_thunks")]] NoDefault {
+              explicit NoDefault(int);
+              NoDefault(NoDefault&&);
+              ~NoDefault();
+              int field;
+            };
+            "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_not_matches!(rs_api, quote! { ::ctor::ConstructN });
+        assert_cc_not_matches!(rs_api_impl, quote! { __crubit_construct_n__9NoDefault });
+        assert_rs_matches!(rs_api, quote! { unsafe impl ::ctor::DestroyN for crate::NoDefault });
+        Ok(())
+    }
+
     #[test]
     fn test_func_ptr_where_params_are_primitive_types() -> Result<()> {
         let ir = ir_from_cc(r#" int (*get_ptr_to_func())(float, double); "#)?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -5044,7 +6252,7 @@ mod tests {
     #[test]
     fn test_func_ptr_where_params_are_raw_ptrs() -> Result<()> {
         let ir = ir_from_cc(r#" const int* (*get_ptr_to_func())(const int*); "#)?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -5119,7 +6327,7 @@ mod tests {
             }
         );
 
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         // Check that the custom "vectorcall" ABI gets propagated into the
         // return type (i.e. into `extern "vectorcall" fn`).
         assert_rs_matches!(
@@ -5850,7 +7058,7 @@ mod tests {
             };
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
 
         assert_rs_matches!(
             rs_api,
@@ -6254,6 +7462,108 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_final_virtual_no_thunk() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"
+            struct Base { virtual void Foo(); virtual void Bar(); };
+            struct FinalMethod : Base { void Foo() final; };
+            struct FinalClass final : Base { void Bar() override; };
+        "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" void __rust_thunk___ZN4Base3FooEv(struct Base * __this)
+            }
+        );
+        assert_cc_not_matches!(rs_api_impl, quote! { __rust_thunk___ZN11FinalMethod3FooEv });
+        assert_cc_not_matches!(rs_api_impl, quote! { __rust_thunk___ZN10FinalClass3BarEv });
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[link_name = "_ZN11FinalMethod3FooEv"]
+                pub(crate) fn __rust_thunk___ZN11FinalMethod3FooEv
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[link_name = "_ZN10FinalClass3BarEv"]
+                pub(crate) fn __rust_thunk___ZN10FinalClass3BarEv
+            }
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn test_nonunpin_trivial_abi_return_no_thunk() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"#pragma clang lifetime_elision
+            struct [[clang::trivial_abi]] UniqueIntPtr {
+              UniqueIntPtr(UniqueIntPtr&&);
+              ~UniqueIntPtr();
+              int* ptr;
+            };
+            UniqueIntPtr MakeUniqueIntPtr();
+            void TakeUniqueIntPtr(UniqueIntPtr p);
+        "#,
+        )?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                ::ctor::FnCtor::new(move |dest: ::std::pin::Pin<&mut ::std::mem::MaybeUninit<crate::UniqueIntPtr>>| {
+                    ::std::pin::Pin::into_inner_unchecked(dest).write(
+                        crate::detail::__rust_thunk___Z16MakeUniqueIntPtrv());
+                })
+            }
+        );
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[link_name = "_Z16MakeUniqueIntPtrv"]
+                pub(crate) fn __rust_thunk___Z16MakeUniqueIntPtrv() -> crate::UniqueIntPtr;
+            }
+        );
+        assert_cc_not_matches!(rs_api_impl, quote! { __rust_thunk___Z16MakeUniqueIntPtrv });
+        // By-value parameters still need a thunk, which runs the move constructor.
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" void __rust_thunk___Z16TakeUniqueIntPtr12UniqueIntPtr(struct UniqueIntPtr* p) {
+                    TakeUniqueIntPtr(std::move(*p));
+                }
+            }
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn test_nonunpin_return_with_opaque_field_has_thunk() -> Result<()> {
+        let ir = ir_from_cc(
+            r#"#pragma clang lifetime_elision
+            struct [[clang::trivial_abi]] HasOpaqueField {
+              HasOpaqueField(HasOpaqueField&&);
+              ~HasOpaqueField();
+              [[no_unique_address]] float f;
+            };
+            HasOpaqueField MakeHasOpaqueField();
+        "#,
+        )?;
+        let rs_api_impl = generate_bindings_tokens(ir)?.rs_api_impl;
+        assert_cc_matches!(
+            rs_api_impl,
+            quote! {
+                extern "C" void __rust_thunk___Z18MakeHasOpaqueFieldv(struct HasOpaqueField* __return) {
+                    new (__return) auto(MakeHasOpaqueField());
+                }
+            }
+        );
+        Ok(())
+    }
+
     #[test]
     fn test_custom_abi_thunk() -> Result<()> {
         let ir = ir_from_cc(
@@ -6262,7 +7572,7 @@ mod tests {
             double f_c_calling_convention(double p1, double p2);
         "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -6429,7 +7739,7 @@ mod tests {
                 int x;
             };"#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_not_matches!(rs_api, quote! {impl Drop});
         assert_rs_not_matches!(rs_api, quote! {impl ::ctor::PinnedDrop});
         assert_rs_matches!(rs_api, quote! {pub x: i32});
@@ -6445,7 +7755,7 @@ mod tests {
                 DefaultedConstructor() = default;
             };"#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -6646,7 +7956,7 @@ mod tests {
                 int i;
             };"#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -6757,7 +8067,7 @@ mod tests {
                 int i;
             };"#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -7168,7 +8478,7 @@ mod tests {
                 namespace bar { void not_overloaded(); }
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
 
         // Cannot overload free functions.
         assert_cc_matches!(rs_api, {
@@ -7222,7 +8532,7 @@ mod tests {
                 inline void f(MyTypedefDecl t) {}
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -7789,7 +9099,7 @@ mod tests {
             Nontrivial ReturnsByValue(const int& x, const int& y);
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -7832,7 +9142,7 @@ mod tests {
             };
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -7882,7 +9192,7 @@ mod tests {
             void TakesByValue(Nontrivial x);
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -7955,7 +9265,7 @@ mod tests {
             void TakesByValue(Nonmovable) {}
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         // Bindings for TakesByValue cannot be generated.
         assert_rs_not_matches!(rs_api, quote! {TakesByValue});
         assert_cc_not_matches!(rs_api_impl, quote! {TakesByValue});
@@ -7975,7 +9285,7 @@ mod tests {
             };
             "#,
         )?;
-        let BindingsTokens { rs_api, rs_api_impl } = generate_bindings_tokens(ir)?;
+        let BindingsTokens { rs_api, rs_api_impl, .. } = generate_bindings_tokens(ir)?;
         assert_rs_matches!(
             rs_api,
             quote! {
@@ -8083,6 +9393,63 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_namespace_module_shards() -> Result<()> {
+        let BindingsTokens { rs_api, rs_api_shards, .. } =
+            generate_sharded_bindings_tokens(ir_from_cc(
+                r#"
+            namespace test_namespace_bindings {
+                int func();
+                namespace inner {
+                    struct InnerS {};
+                }
+            }
+            namespace test_namespace_bindings {
+                int func2();
+            }
+            struct TopLevelS {};
+        "#,
+            )?)?;
+        assert_rs_matches!(
+            rs_api,
+            quote! {
+                #[path = "rs_api_shards/test_namespace_bindings_0.rs"]
+                pub mod test_namespace_bindings_0;
+                ...
+                #[path = "rs_api_shards/test_namespace_bindings.rs"]
+                pub mod test_namespace_bindings;
+                ...
+                pub struct TopLevelS { ... }
+            }
+        );
+        assert_rs_not_matches!(rs_api, quote! { pub fn func() -> i32 });
+        assert_eq!(
+            rs_api_shards.keys().collect_vec(),
+            ["test_namespace_bindings.rs", "test_namespace_bindings_0.rs"]
+        );
+        assert_rs_matches!(
+            rs_api_shards["test_namespace_bindings_0.rs"],
+            quote! {
+                pub fn func() -> i32 { ... }
+                ...
+                pub mod inner {
+                    ...
+                    pub struct InnerS { ... }
+                    ...
+                }
+            }
+        );
+        assert_rs_matches!(
+            rs_api_shards["test_namespace_bindings.rs"],
+            quote! {
+                pub use super::test_namespace_bindings_0::*;
+                ...
+                pub fn func2() -> i32 { ... }
+            }
+        );
+        Ok(())
+    }
+
     #[test]
     fn test_detail_outside_of_namespace_module() -> Result<()> {
         let rs_api = generate_bindings_tokens(ir_from_cc(
@@ -8345,20 +9712,20 @@ mod tests {
         );
 
         // User defined methods in mangled name order
-        let my_struct_bool_method =
-            make_rs_ident("__rust_thunk___ZN8MyStructIbE4getTEv__2f_2ftest_3atesting_5ftarget");
-        let my_struct_double_method =
-            make_rs_ident("__rust_thunk___ZN8MyStructIdE4getTEv__2f_2ftest_3atesting_5ftarget");
-        let my_struct_int_method =
-            make_rs_ident("__rust_thunk___ZN8MyStructIiE4getTEv__2f_2ftest_3atesting_5ftarget");
+        let my_struct_bool_method = make_rs_ident("__rust_thunk___ZN8MyStructIbE4getTEv");
+        let my_struct_double_method = make_rs_ident("__rust_thunk___ZN8MyStructIdE4getTEv");
+        let my_struct_int_method = make_rs_ident("__rust_thunk___ZN8MyStructIiE4getTEv");
 
         assert_cc_matches!(
             &bindings.rs_api_impl,
             quote! {
                 ...
-                extern "C" bool #my_struct_bool_method(struct MyStruct<bool>*__this) {...} ...
-                extern "C" double #my_struct_double_method(struct MyStruct<double>*__this) {...} ...
-                extern "C" int #my_struct_int_method(struct MyStruct<int>*__this) {...} ...
+                extern "C" inline __attribute__((used))
+                bool #my_struct_bool_method(struct MyStruct<bool>*__this) {...} ...
+                extern "C" inline __attribute__((used))
+                double #my_struct_double_method(struct MyStruct<double>*__this) {...} ...
+                extern "C" inline __attribute__((used))
+                int #my_struct_int_method(struct MyStruct<int>*__this) {...} ...
             }
         );
         Ok(())
@@ -0,0 +1,78 @@
+# Part of the Crubit project, under the Apache License v2.0 with LLVM
+# Exceptions. See /LICENSE for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""Tests that thunks are compiled to LLVM bitcode in the cross-language inlining mode."""
+
+load("@bazel_skylib//lib:unittest.bzl", "analysistest", "asserts")
+load(
+    "//rs_bindings_from_cc/test/bazel_unit_tests:defs.bzl",
+    "ActionsInfo",
+    "attach_aspect",
+)
+
+_CROSS_LANGUAGE_INLINING = "//rs_bindings_from_cc/bazel_support:cross_language_inlining"
+
+def _thunks_compile_action(tut):
+    return [
+        a
+        for a in tut[ActionsInfo].actions
+        if a.mnemonic == "CppCompile" and
+           [i for i in a.inputs.to_list() if i.basename.endswith("_rust_api_impl.cc")]
+    ][0]
+
+def _thunks_compiled_to_bitcode_test_impl(ctx):
+    env = analysistest.begin(ctx)
+    tut = analysistest.target_under_test(env)
+
+    action = _thunks_compile_action(tut)
+    asserts.true(env, "-flto=thin" in action.argv)
+
+    return analysistest.end(env)
+
+thunks_compiled_to_bitcode_test = analysistest.make(
+    _thunks_compiled_to_bitcode_test_impl,
+    config_settings = {
+        _CROSS_LANGUAGE_INLINING: True,
+    },
+)
+
+def _thunks_compiled_to_machine_code_by_default_test_impl(ctx):
+    env = analysistest.begin(ctx)
+    tut = analysistest.target_under_test(env)
+
+    action = _thunks_compile_action(tut)
+    asserts.false(env, "-flto=thin" in action.argv)
+
+    return analysistest.end(env)
+
+thunks_compiled_to_machine_code_by_default_test = analysistest.make(
+    _thunks_compiled_to_machine_code_by_default_test_impl,
+)
+
+def _test_cross_language_inlining():
+    native.cc_library(name = "lib", hdrs = ["lib.h"])
+    attach_aspect(name = "lib_with_aspect", dep = ":lib")
+    thunks_compiled_to_bitcode_test(
+        name = "thunks_compiled_to_bitcode_test",
+        target_under_test = ":lib_with_aspect",
+    )
+    thunks_compiled_to_machine_code_by_default_test(
+        name = "thunks_compiled_to_machine_code_by_default_test",
+        target_under_test = ":lib_with_aspect",
+    )
+
+def cross_language_inlining_test(name):
+    """Sets up cross_language_inlining_test test suite.
+
+    Args:
+      name: name of the test suite"""
+    _test_cross_language_inlining()
+
+    native.test_suite(
+        name = name,
+        tests = [
+            ":thunks_compiled_to_bitcode_test",
+            ":thunks_compiled_to_machine_code_by_default_test",
+        ],
+    )
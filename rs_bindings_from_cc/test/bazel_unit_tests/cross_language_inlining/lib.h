@@ -0,0 +1,10 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef CRUBIT_RS_BINDINGS_FROM_CC_TEST_BAZEL_UNIT_TESTS_CROSS_LANGUAGE_INLINING_LIB_H_
+#define CRUBIT_RS_BINDINGS_FROM_CC_TEST_BAZEL_UNIT_TESTS_CROSS_LANGUAGE_INLINING_LIB_H_
+
+inline int add_one(int x) { return x + 1; }
+
+#endif  // CRUBIT_RS_BINDINGS_FROM_CC_TEST_BAZEL_UNIT_TESTS_CROSS_LANGUAGE_INLINING_LIB_H_
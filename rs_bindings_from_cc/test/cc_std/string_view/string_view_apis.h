@@ -12,6 +12,8 @@ inline std::string_view GetHelloWorld() { return "Hello, world!"; }
 
 inline std::string_view GetInvalidUtf8() { return "Not a UTF-8 byte: \xff"; }
 
+inline std::string_view GetDefault() { return std::string_view(); }
+
 }  // namespace crubit_string_view
 
 #endif  // THIRD_PARTY_CRUBIT_RS_BINDINGS_FROM_CC_TEST_CC_STD_STRING_VIEW_STRING_VIEW_APIS_H_
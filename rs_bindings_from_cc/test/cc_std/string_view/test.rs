@@ -2,7 +2,7 @@
 // Exceptions. See /LICENSE for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-use string_view_apis::crubit_string_view::{GetHelloWorld, GetInvalidUtf8};
+use string_view_apis::crubit_string_view::{GetDefault, GetHelloWorld, GetInvalidUtf8};
 
 #[test]
 fn test_valid_utf8_str() {
@@ -15,3 +15,15 @@ fn test_invalid_utf8_str() {
     let not_a_str: Result<&'static str, _> = GetInvalidUtf8().try_into();
     let _ = not_a_str.unwrap_err();
 }
+
+#[test]
+fn test_bytes() {
+    let hello_bytes: &'static [u8] = GetHelloWorld().into();
+    assert_eq!(hello_bytes, b"Hello, world!");
+}
+
+#[test]
+fn test_default_is_empty() {
+    let empty: &'static [u8] = GetDefault().into();
+    assert!(empty.is_empty());
+}
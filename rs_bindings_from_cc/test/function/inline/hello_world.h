@@ -18,8 +18,20 @@ inline int take_struct_by_const_ref(const SomeStruct& s) { return s.int_field; }
 
 // This testcase helps verify that thunks correctly work with primitive types
 // that have multi-word type names (e.g. `unsigned int`). Using an 'inline'
-// method forces generation of a C++ thunk.
-inline unsigned int double_unsigned_int(unsigned int i) { return 2 * i; }
+// method forces generation of a C++ thunk. (The local variable keeps the body
+// from being implemented in Rust; compare with `SomeCounter` below, whose
+// single-`return` methods are.)
+inline unsigned int double_unsigned_int(unsigned int i) {
+  unsigned int result = 2 * i;
+  return result;
+}
+
+// Trivial inline functions are implemented in Rust, without a C++ thunk.
+struct SomeCounter final {
+  unsigned int wrapping_sum(unsigned int delta) const { return count + delta; }
+  bool is_empty() const { return count == 0; }
+  unsigned int count;
+};
 
 // This is a regression test for b/244630626.  This mimics the standard library
 // that forward-declares and then defines an inline `get_id` function in a
@@ -0,0 +1,27 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+use hello_world::*;
+use std::time::Instant;
+
+const ITERATIONS: u32 = 100_000_000;
+
+fn main() {
+    let start = Instant::now();
+    let mut sum: u32 = 0;
+    for i in 0..ITERATIONS {
+        // The volatile read keeps the optimizer from hoisting or folding the
+        // calls, so that the loop body is dominated by the call itself.
+        let i = unsafe { std::ptr::read_volatile(&i) };
+        sum = sum.wrapping_add(double_unsigned_int(i));
+    }
+    let elapsed = start.elapsed();
+    println!(
+        "{} calls in {:?} ({:.2} ns/call, checksum {})",
+        ITERATIONS,
+        elapsed,
+        elapsed.as_nanos() as f64 / ITERATIONS as f64,
+        sum
+    );
+}
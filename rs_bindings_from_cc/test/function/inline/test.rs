@@ -22,6 +22,14 @@ mod tests {
         assert_eq!(double_unsigned_int(123), 246);
     }
 
+    #[test]
+    fn test_trivial_inline_methods() {
+        let counter = SomeCounter { count: u32::MAX };
+        assert_eq!(counter.wrapping_sum(2), 1);
+        assert!(!counter.is_empty());
+        assert!(SomeCounter { count: 0 }.is_empty());
+    }
+
     #[test]
     fn test_forward_declared_doubler() {
         assert_eq!(foo::forward_declared_doubler(124), 248);
@@ -476,7 +476,7 @@ impl ::ctor::CtorNew<()> for __CcTemplateInstN28template_with_preferred_name12So
         let () = args;
         unsafe {
             ::ctor::FnCtor::new(move |dest: ::std::pin::Pin<&mut ::std::mem::MaybeUninit<Self>>| {
-                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(::std::pin::Pin::into_inner_unchecked(dest));
+                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev(::std::pin::Pin::into_inner_unchecked(dest));
             })
         }
     }
@@ -492,7 +492,7 @@ impl<'b> ::ctor::CtorNew<&'b Self>
         let __param_0 = args;
         unsafe {
             ::ctor::FnCtor::new(move |dest: ::std::pin::Pin<&mut ::std::mem::MaybeUninit<Self>>| {
-                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(::std::pin::Pin::into_inner_unchecked(dest),__param_0);
+                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1_(::std::pin::Pin::into_inner_unchecked(dest),__param_0);
             })
         }
     }
@@ -518,7 +518,7 @@ impl<'b> ::ctor::CtorNew<::ctor::RvalueReference<'b, Self>>
         let __param_0 = args;
         unsafe {
             ::ctor::FnCtor::new(move |dest: ::std::pin::Pin<&mut ::std::mem::MaybeUninit<Self>>| {
-                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(::std::pin::Pin::into_inner_unchecked(dest),__param_0);
+                crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1_(::std::pin::Pin::into_inner_unchecked(dest),__param_0);
             })
         }
     }
@@ -541,7 +541,7 @@ impl<'b> ::ctor::Assign<&'b Self>
     #[inline(always)]
     fn assign<'a>(self: ::std::pin::Pin<&'a mut Self>, __param_0: &'b Self) {
         unsafe {
-            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1_(self,__param_0);
         }
     }
 }
@@ -556,7 +556,7 @@ impl<'b> ::ctor::Assign<::ctor::RvalueReference<'b, Self>>
         __param_0: ::ctor::RvalueReference<'b, Self>,
     ) {
         unsafe {
-            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1_(self,__param_0);
         }
     }
 }
@@ -566,7 +566,7 @@ impl __CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE {
     #[inline(always)]
     pub fn foo<'a>(self: ::std::pin::Pin<&'a mut Self>) -> i32 {
         unsafe {
-            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(self)
+            crate::detail::__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv(self)
         }
     }
 }
@@ -651,14 +651,14 @@ mod detail {
             __this: ::std::pin::Pin<&'a mut crate::HasCustomAlignmentWithGnuAttr>,
             __param_0: ::ctor::RvalueReference<'b, crate::HasCustomAlignmentWithGnuAttr>,
         ) -> ::std::pin::Pin<&'a mut crate::HasCustomAlignmentWithGnuAttr>;
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev<
             'a,
         >(
             __this: &'a mut ::std::mem::MaybeUninit<
                 crate::__CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE,
             >,
         );
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1_<
             'a,
             'b,
         >(
@@ -667,7 +667,7 @@ mod detail {
             >,
             __param_0: &'b crate::__CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE,
         );
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1_<
             'a,
             'b,
         >(
@@ -679,7 +679,7 @@ mod detail {
                 crate::__CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE,
             >,
         );
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1_<
             'a,
             'b,
         >(
@@ -690,7 +690,7 @@ mod detail {
         ) -> ::std::pin::Pin<
             &'a mut crate::__CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE,
         >;
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1_<
             'a,
             'b,
         >(
@@ -704,7 +704,7 @@ mod detail {
         ) -> ::std::pin::Pin<
             &'a mut crate::__CcTemplateInstN28template_with_preferred_name12SomeTemplateIiEE,
         >;
-        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc<
+        pub(crate) fn __rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv<
             'a,
         >(
             __this: ::std::pin::Pin<
@@ -118,35 +118,37 @@ __rust_thunk___ZN29HasCustomAlignmentWithGnuAttraSEOS_(
     struct HasCustomAlignmentWithGnuAttr* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1Ev(
     struct template_with_preferred_name::SomeTemplate<int>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1ERKS1_(
     struct template_with_preferred_name::SomeTemplate<int>* __this,
     const struct template_with_preferred_name::SomeTemplate<int>* __param_0) {
   crubit::construct_at(__this, *__param_0);
 }
-extern "C" void
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEC1EOS1_(
     struct template_with_preferred_name::SomeTemplate<int>* __this,
     struct template_with_preferred_name::SomeTemplate<int>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct template_with_preferred_name::SomeTemplate<int>*
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+extern "C" inline __attribute__((used))
+struct template_with_preferred_name::SomeTemplate<int>*
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSERKS1_(
     struct template_with_preferred_name::SomeTemplate<int>* __this,
     const struct template_with_preferred_name::SomeTemplate<int>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct template_with_preferred_name::SomeTemplate<int>*
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+} extern "C" inline __attribute__((used))
+struct template_with_preferred_name::SomeTemplate<int>*
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiEaSEOS1_(
     struct template_with_preferred_name::SomeTemplate<int>* __this,
     struct template_with_preferred_name::SomeTemplate<int>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" int
-__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3aclang_5fattrs_5fcc(
+} extern "C" inline __attribute__((used)) int
+__rust_thunk___ZN28template_with_preferred_name12SomeTemplateIiE3fooEv(
     struct template_with_preferred_name::SomeTemplate<int>* __this) {
   return __this->foo();
 }
@@ -367,7 +367,7 @@ impl<'b> ::ctor::UnpinAssign<::ctor::RvalueReference<'b, Self>> for MultilineOne
 /// Generated from: rs_bindings_from_cc/test/golden/doc_comment.h;l=69
 #[inline(always)]
 pub fn foo() -> i32 {
-    unsafe { crate::detail::__rust_thunk___Z3foov() }
+    42i32
 }
 
 /// A type alias
@@ -425,7 +425,7 @@ impl Default for __CcTemplateInst10MyTemplateIiE {
     fn default() -> Self {
         let mut tmp = ::std::mem::MaybeUninit::<Self>::zeroed();
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(&mut tmp);
+            crate::detail::__rust_thunk___ZN10MyTemplateIiEC1Ev(&mut tmp);
             tmp.assume_init()
         }
     }
@@ -437,7 +437,7 @@ impl<'b> From<::ctor::RvalueReference<'b, Self>> for __CcTemplateInst10MyTemplat
     fn from(__param_0: ::ctor::RvalueReference<'b, Self>) -> Self {
         let mut tmp = ::std::mem::MaybeUninit::<Self>::zeroed();
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIiEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(&mut tmp,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIiEC1EOS0_(&mut tmp,__param_0);
             tmp.assume_init()
         }
     }
@@ -448,7 +448,7 @@ impl<'b> ::ctor::UnpinAssign<&'b Self> for __CcTemplateInst10MyTemplateIiE {
     #[inline(always)]
     fn unpin_assign<'a>(&'a mut self, __param_0: &'b Self) {
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIiEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIiEaSERKS0_(self,__param_0);
         }
     }
 }
@@ -460,7 +460,7 @@ impl<'b> ::ctor::UnpinAssign<::ctor::RvalueReference<'b, Self>>
     #[inline(always)]
     fn unpin_assign<'a>(&'a mut self, __param_0: ::ctor::RvalueReference<'b, Self>) {
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIiEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIiEaSEOS0_(self,__param_0);
         }
     }
 }
@@ -474,7 +474,7 @@ impl __CcTemplateInst10MyTemplateIiE {
     #[inline(always)]
     pub fn get_field_value<'a>(&'a self) -> &'a i32 {
         unsafe {
-            crate::detail::__rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self)
+            crate::detail::__rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv(self)
         }
     }
 }
@@ -499,7 +499,7 @@ impl Default for __CcTemplateInst10MyTemplateIfE {
     fn default() -> Self {
         let mut tmp = ::std::mem::MaybeUninit::<Self>::zeroed();
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIfEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(&mut tmp);
+            crate::detail::__rust_thunk___ZN10MyTemplateIfEC1Ev(&mut tmp);
             tmp.assume_init()
         }
     }
@@ -511,7 +511,7 @@ impl<'b> From<::ctor::RvalueReference<'b, Self>> for __CcTemplateInst10MyTemplat
     fn from(__param_0: ::ctor::RvalueReference<'b, Self>) -> Self {
         let mut tmp = ::std::mem::MaybeUninit::<Self>::zeroed();
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIfEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(&mut tmp,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIfEC1EOS0_(&mut tmp,__param_0);
             tmp.assume_init()
         }
     }
@@ -522,7 +522,7 @@ impl<'b> ::ctor::UnpinAssign<&'b Self> for __CcTemplateInst10MyTemplateIfE {
     #[inline(always)]
     fn unpin_assign<'a>(&'a mut self, __param_0: &'b Self) {
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIfEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIfEaSERKS0_(self,__param_0);
         }
     }
 }
@@ -534,7 +534,7 @@ impl<'b> ::ctor::UnpinAssign<::ctor::RvalueReference<'b, Self>>
     #[inline(always)]
     fn unpin_assign<'a>(&'a mut self, __param_0: ::ctor::RvalueReference<'b, Self>) {
         unsafe {
-            crate::detail::__rust_thunk___ZN10MyTemplateIfEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self,__param_0);
+            crate::detail::__rust_thunk___ZN10MyTemplateIfEaSEOS0_(self,__param_0);
         }
     }
 }
@@ -546,7 +546,7 @@ impl __CcTemplateInst10MyTemplateIfE {
     #[inline(always)]
     pub fn get_field_value<'a>(&'a self) -> &'a f32 {
         unsafe {
-            crate::detail::__rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(self)
+            crate::detail::__rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv(self)
         }
     }
 }
@@ -647,65 +647,64 @@ mod detail {
             __this: &'a mut crate::MultilineOneStar,
             __param_0: ::ctor::RvalueReference<'b, crate::MultilineOneStar>,
         ) -> &'a mut crate::MultilineOneStar;
-        pub(crate) fn __rust_thunk___Z3foov() -> i32;
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEC1Ev<
             'a,
         >(
             __this: &'a mut ::std::mem::MaybeUninit<crate::__CcTemplateInst10MyTemplateIiE>,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEC1EOS0_<
             'a,
             'b,
         >(
             __this: &'a mut ::std::mem::MaybeUninit<crate::__CcTemplateInst10MyTemplateIiE>,
             __param_0: ::ctor::RvalueReference<'b, crate::__CcTemplateInst10MyTemplateIiE>,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEaSERKS0_<
             'a,
             'b,
         >(
             __this: &'a mut crate::__CcTemplateInst10MyTemplateIiE,
             __param_0: &'b crate::__CcTemplateInst10MyTemplateIiE,
         ) -> &'a mut crate::__CcTemplateInst10MyTemplateIiE;
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIiEaSEOS0_<
             'a,
             'b,
         >(
             __this: &'a mut crate::__CcTemplateInst10MyTemplateIiE,
             __param_0: ::ctor::RvalueReference<'b, crate::__CcTemplateInst10MyTemplateIiE>,
         ) -> &'a mut crate::__CcTemplateInst10MyTemplateIiE;
-        pub(crate) fn __rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv<
             'a,
         >(
             __this: &'a crate::__CcTemplateInst10MyTemplateIiE,
         ) -> &'a i32;
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEC1Ev<
             'a,
         >(
             __this: &'a mut ::std::mem::MaybeUninit<crate::__CcTemplateInst10MyTemplateIfE>,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEC1EOS0_<
             'a,
             'b,
         >(
             __this: &'a mut ::std::mem::MaybeUninit<crate::__CcTemplateInst10MyTemplateIfE>,
             __param_0: ::ctor::RvalueReference<'b, crate::__CcTemplateInst10MyTemplateIfE>,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEaSERKS0_<
             'a,
             'b,
         >(
             __this: &'a mut crate::__CcTemplateInst10MyTemplateIfE,
             __param_0: &'b crate::__CcTemplateInst10MyTemplateIfE,
         ) -> &'a mut crate::__CcTemplateInst10MyTemplateIfE;
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIfEaSEOS0_<
             'a,
             'b,
         >(
             __this: &'a mut crate::__CcTemplateInst10MyTemplateIfE,
             __param_0: ::ctor::RvalueReference<'b, crate::__CcTemplateInst10MyTemplateIfE>,
         ) -> &'a mut crate::__CcTemplateInst10MyTemplateIfE;
-        pub(crate) fn __rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc<
+        pub(crate) fn __rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv<
             'a,
         >(
             __this: &'a crate::__CcTemplateInst10MyTemplateIfE,
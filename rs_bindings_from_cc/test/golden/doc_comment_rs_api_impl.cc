@@ -98,51 +98,50 @@ extern "C" struct MultilineOneStar* __rust_thunk___ZN16MultilineOneStaraSEOS_(
     struct MultilineOneStar* __this, struct MultilineOneStar* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" int __rust_thunk___Z3foov() { return foo(); }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIiEC1Ev(
     struct MyTemplate<int>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIiEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIiEC1EOS0_(
     struct MyTemplate<int>* __this, struct MyTemplate<int>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct MyTemplate<int>*
-__rust_thunk___ZN10MyTemplateIiEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) struct MyTemplate<int>*
+__rust_thunk___ZN10MyTemplateIiEaSERKS0_(
     struct MyTemplate<int>* __this, const struct MyTemplate<int>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct MyTemplate<int>*
-__rust_thunk___ZN10MyTemplateIiEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+} extern "C" inline __attribute__((used)) struct MyTemplate<int>*
+__rust_thunk___ZN10MyTemplateIiEaSEOS0_(
     struct MyTemplate<int>* __this, struct MyTemplate<int>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" int const*
-__rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+} extern "C" inline __attribute__((used)) int const*
+__rust_thunk___ZNK10MyTemplateIiE15get_field_valueEv(
     const struct MyTemplate<int>* __this) {
   return &__this->get_field_value();
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIfEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIfEC1Ev(
     struct MyTemplate<float>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIfEC1EOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIfEC1EOS0_(
     struct MyTemplate<float>* __this, struct MyTemplate<float>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct MyTemplate<float>*
-__rust_thunk___ZN10MyTemplateIfEaSERKS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+extern "C" inline __attribute__((used)) struct MyTemplate<float>*
+__rust_thunk___ZN10MyTemplateIfEaSERKS0_(
     struct MyTemplate<float>* __this,
     const struct MyTemplate<float>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct MyTemplate<float>*
-__rust_thunk___ZN10MyTemplateIfEaSEOS0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+} extern "C" inline __attribute__((used)) struct MyTemplate<float>*
+__rust_thunk___ZN10MyTemplateIfEaSEOS0_(
     struct MyTemplate<float>* __this, struct MyTemplate<float>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" float const*
-__rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3adoc_5fcomment_5fcc(
+} extern "C" inline __attribute__((used)) float const*
+__rust_thunk___ZNK10MyTemplateIfE15get_field_valueEv(
     const struct MyTemplate<float>* __this) {
   return &__this->get_field_value();
 }
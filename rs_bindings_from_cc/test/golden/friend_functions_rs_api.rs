@@ -103,7 +103,7 @@ pub fn visible_rref<'a>(__param_0: ::ctor::RvalueReference<'a, crate::SomeClass>
 /// Generated from: rs_bindings_from_cc/test/golden/friend_functions.h;l=26
 #[inline(always)]
 pub fn multiple_declarations<'a>(__param_0: &'a crate::SomeClass) -> i32 {
-    unsafe { crate::detail::__rust_thunk___Z21multiple_declarationsRK9SomeClass(__param_0) }
+    123i32
 }
 
 // CRUBIT_RS_BINDINGS_FROM_CC_TEST_GOLDEN_FRIEND_FUNCTIONS_H_
@@ -141,9 +141,6 @@ mod detail {
         pub(crate) fn __rust_thunk___Z12visible_rrefO9SomeClass<'a>(
             __param_0: ::ctor::RvalueReference<'a, crate::SomeClass>,
         );
-        pub(crate) fn __rust_thunk___Z21multiple_declarationsRK9SomeClass<'a>(
-            __param_0: &'a crate::SomeClass,
-        ) -> i32;
     }
 }
 
@@ -31,10 +31,6 @@ extern "C" class SomeClass* __rust_thunk___ZN9SomeClassaSEOS_(
     class SomeClass* __this, class SomeClass* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" int __rust_thunk___Z21multiple_declarationsRK9SomeClass(
-    const class SomeClass* __param_0) {
-  return multiple_declarations(*__param_0);
-}
 
 static_assert(sizeof(class SomeClass) == 1);
 static_assert(alignof(class SomeClass) == 1);
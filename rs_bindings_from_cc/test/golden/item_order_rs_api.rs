@@ -72,7 +72,7 @@ impl<'b> ::ctor::UnpinAssign<::ctor::RvalueReference<'b, Self>> for FirstStruct
 /// Generated from: rs_bindings_from_cc/test/golden/item_order.h;l=14
 #[inline(always)]
 pub fn first_func() -> i32 {
-    unsafe { crate::detail::__rust_thunk___Z10first_funcv() }
+    42i32
 }
 
 /// Generated from: rs_bindings_from_cc/test/golden/item_order.h;l=16
@@ -130,7 +130,7 @@ impl<'b> ::ctor::UnpinAssign<::ctor::RvalueReference<'b, Self>> for SecondStruct
 /// Generated from: rs_bindings_from_cc/test/golden/item_order.h;l=20
 #[inline(always)]
 pub fn second_func() -> i32 {
-    unsafe { crate::detail::__rust_thunk___Z11second_funcv() }
+    23i32
 }
 
 // CRUBIT_RS_BINDINGS_FROM_CC_TEST_GOLDEN_ITEM_ORDER_H_
@@ -154,7 +154,6 @@ mod detail {
             __this: &'a mut crate::FirstStruct,
             __param_0: ::ctor::RvalueReference<'b, crate::FirstStruct>,
         ) -> &'a mut crate::FirstStruct;
-        pub(crate) fn __rust_thunk___Z10first_funcv() -> i32;
         pub(crate) fn __rust_thunk___ZN12SecondStructC1Ev<'a>(
             __this: &'a mut ::std::mem::MaybeUninit<crate::SecondStruct>,
         );
@@ -170,7 +169,6 @@ mod detail {
             __this: &'a mut crate::SecondStruct,
             __param_0: ::ctor::RvalueReference<'b, crate::SecondStruct>,
         ) -> &'a mut crate::SecondStruct;
-        pub(crate) fn __rust_thunk___Z11second_funcv() -> i32;
     }
 }
 
@@ -31,7 +31,6 @@ extern "C" struct FirstStruct* __rust_thunk___ZN11FirstStructaSEOS_(
     struct FirstStruct* __this, struct FirstStruct* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" int __rust_thunk___Z10first_funcv() { return first_func(); }
 extern "C" void __rust_thunk___ZN12SecondStructC1Ev(
     struct SecondStruct* __this) {
   crubit::construct_at(__this);
@@ -48,7 +47,6 @@ extern "C" struct SecondStruct* __rust_thunk___ZN12SecondStructaSEOS_(
     struct SecondStruct* __this, struct SecondStruct* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" int __rust_thunk___Z11second_funcv() { return second_func(); }
 
 static_assert(sizeof(struct FirstStruct) == 4);
 static_assert(alignof(struct FirstStruct) == 4);
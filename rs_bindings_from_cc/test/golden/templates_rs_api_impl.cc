@@ -32,106 +32,116 @@ extern "C" struct DifferentScope* __rust_thunk___ZN14DifferentScopeaSEOS_(
     struct DifferentScope* __this, struct DifferentScope* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEC1Ev(
     class test_namespace_bindings::MyTemplate<DifferentScope>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEC1Ev(
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEC1Ev(
     class test_namespace_bindings::MyTemplate<int>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEC1EOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEC1EOS2_(
     class test_namespace_bindings::MyTemplate<DifferentScope>* __this,
     class test_namespace_bindings::MyTemplate<DifferentScope>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEC1EOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEC1EOS2_(
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __this,
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEC1EOS1_(
     class test_namespace_bindings::MyTemplate<int>* __this,
     class test_namespace_bindings::MyTemplate<int>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" class test_namespace_bindings::MyTemplate<DifferentScope>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEaSERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<DifferentScope>*
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEaSERKS2_(
     class test_namespace_bindings::MyTemplate<DifferentScope>* __this,
     const class test_namespace_bindings::MyTemplate<DifferentScope>*
         __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" class test_namespace_bindings::MyTemplate<
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<
     test_namespace_bindings::TemplateParam>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEaSERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEaSERKS2_(
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __this,
     const class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" class test_namespace_bindings::MyTemplate<int>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<int>*
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEaSERKS1_(
     class test_namespace_bindings::MyTemplate<int>* __this,
     const class test_namespace_bindings::MyTemplate<int>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" class test_namespace_bindings::MyTemplate<DifferentScope>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEaSEOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<DifferentScope>*
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeEaSEOS2_(
     class test_namespace_bindings::MyTemplate<DifferentScope>* __this,
     class test_namespace_bindings::MyTemplate<DifferentScope>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" class test_namespace_bindings::MyTemplate<
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<
     test_namespace_bindings::TemplateParam>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEaSEOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEEaSEOS2_(
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __this,
     class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" class test_namespace_bindings::MyTemplate<int>*
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<int>*
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiEaSEOS1_(
     class test_namespace_bindings::MyTemplate<int>* __this,
     class test_namespace_bindings::MyTemplate<int>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" class test_namespace_bindings::MyTemplate<DifferentScope>
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeE6CreateES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<DifferentScope>
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateI14DifferentScopeE6CreateES1_(
     struct DifferentScope value) {
   return test_namespace_bindings::MyTemplate<DifferentScope>::Create(value);
-} extern "C" class test_namespace_bindings::MyTemplate<
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<
     test_namespace_bindings::TemplateParam>
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEE6CreateES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateINS_13TemplateParamEE6CreateES1_(
     struct test_namespace_bindings::TemplateParam value) {
   return test_namespace_bindings::MyTemplate<
       test_namespace_bindings::TemplateParam>::Create(value);
-} extern "C" class test_namespace_bindings::MyTemplate<int>
-__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiE6CreateEi__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+class test_namespace_bindings::MyTemplate<int>
+__rust_thunk___ZN23test_namespace_bindings10MyTemplateIiE6CreateEi(
     int value) {
   return test_namespace_bindings::MyTemplate<int>::Create(value);
-} extern "C" const struct DifferentScope*
-__rust_thunk___ZNK23test_namespace_bindings10MyTemplateI14DifferentScopeE5valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used)) const struct DifferentScope*
+__rust_thunk___ZNK23test_namespace_bindings10MyTemplateI14DifferentScopeE5valueEv(
     const class test_namespace_bindings::MyTemplate<DifferentScope>* __this) {
   return &__this->value();
 }
-extern "C" const struct test_namespace_bindings::TemplateParam*
-__rust_thunk___ZNK23test_namespace_bindings10MyTemplateINS_13TemplateParamEE5valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used))
+const struct test_namespace_bindings::TemplateParam*
+__rust_thunk___ZNK23test_namespace_bindings10MyTemplateINS_13TemplateParamEE5valueEv(
     const class test_namespace_bindings::MyTemplate<
         test_namespace_bindings::TemplateParam>* __this) {
   return &__this->value();
 }
-extern "C" int const*
-__rust_thunk___ZNK23test_namespace_bindings10MyTemplateIiE5valueEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) int const*
+__rust_thunk___ZNK23test_namespace_bindings10MyTemplateIiE5valueEv(
     const class test_namespace_bindings::MyTemplate<int>* __this) {
   return &__this->value();
 }
@@ -157,25 +167,25 @@ __rust_thunk___ZN23test_namespace_bindings13TemplateParamaSEOS0_(
     struct test_namespace_bindings::TemplateParam* __param_0) {
   return &__this->operator=(std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEC1Ev(
     struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>*
         __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEC1Ev(
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEC1Ev(
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEC1EOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEC1EOS2_(
     struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<
@@ -183,153 +193,165 @@ __rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEC1E
         __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEC1EOS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
         __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEC1EOS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
         __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct test_namespace_bindings::TemplateWithTwoParams<
+extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<
     test_namespace_bindings::TemplateWithTwoParams<int, int>, int>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEaSERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEaSERKS2_(
     struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>* __this,
     const struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>*
         __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEaSERKS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>* __this,
     const struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
         __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEaSERKS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>* __this,
     const struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
         __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct test_namespace_bindings::TemplateWithTwoParams<
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<
     test_namespace_bindings::TemplateWithTwoParams<int, int>, int>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEaSEOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsINS0_IiiEEiEaSEOS2_(
     struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<
         test_namespace_bindings::TemplateWithTwoParams<int, int>, int>*
         __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIifEaSEOS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<int, float>*
         __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
-__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
+__rust_thunk___ZN23test_namespace_bindings21TemplateWithTwoParamsIiiEaSEOS1_(
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>* __this,
     struct test_namespace_bindings::TemplateWithTwoParams<int, int>*
         __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" void
-__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1Ev(
     struct test_namespace_bindings::MyStruct<char>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1ERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1ERKS1_(
     struct test_namespace_bindings::MyStruct<char>* __this,
     const struct test_namespace_bindings::MyStruct<char>* __param_0) {
   crubit::construct_at(__this, *__param_0);
 }
-extern "C" void
-__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1EOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN23test_namespace_bindings8MyStructIcEC1EOS1_(
     struct test_namespace_bindings::MyStruct<char>* __this,
     struct test_namespace_bindings::MyStruct<char>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct test_namespace_bindings::MyStruct<char>*
-__rust_thunk___ZN23test_namespace_bindings8MyStructIcEaSERKS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used))
+struct test_namespace_bindings::MyStruct<char>*
+__rust_thunk___ZN23test_namespace_bindings8MyStructIcEaSERKS1_(
     struct test_namespace_bindings::MyStruct<char>* __this,
     const struct test_namespace_bindings::MyStruct<char>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct test_namespace_bindings::MyStruct<char>*
-__rust_thunk___ZN23test_namespace_bindings8MyStructIcEaSEOS1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct test_namespace_bindings::MyStruct<char>*
+__rust_thunk___ZN23test_namespace_bindings8MyStructIcEaSEOS1_(
     struct test_namespace_bindings::MyStruct<char>* __this,
     struct test_namespace_bindings::MyStruct<char>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" void
-__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEC1Ev(
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEC1EOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEC1EOS2_(
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>* __this,
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
         __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
-__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEaSERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used))
+struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
+__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEaSERKS2_(
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>* __this,
     const struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
         __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
-__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEaSEOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used))
+struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
+__rust_thunk___ZN18MyTopLevelTemplateIN23test_namespace_bindings13TemplateParamEEaSEOS2_(
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>* __this,
     struct MyTopLevelTemplate<test_namespace_bindings::TemplateParam>*
         __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" void
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1Ev__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+} extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1Ev(
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __this) {
   crubit::construct_at(__this);
 }
-extern "C" void
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1ERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1ERKS2_(
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __this,
     const class template_template_params::MyTemplate<
         template_template_params::Policy>* __param_0) {
   crubit::construct_at(__this, *__param_0);
 }
-extern "C" void
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1EOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEC1EOS2_(
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __this,
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __param_0) {
   crubit::construct_at(__this, std::move(*__param_0));
 }
-extern "C" class template_template_params::MyTemplate<
+extern "C" inline __attribute__((used))
+class template_template_params::MyTemplate<
     template_template_params::Policy>*
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEaSERKS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEaSERKS2_(
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __this,
     const class template_template_params::MyTemplate<
         template_template_params::Policy>* __param_0) {
   return &__this->operator=(*__param_0);
-} extern "C" class template_template_params::MyTemplate<
+} extern "C" inline __attribute__((used))
+class template_template_params::MyTemplate<
     template_template_params::Policy>*
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEaSEOS2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc(
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEEaSEOS2_(
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __this,
     class template_template_params::MyTemplate<
         template_template_params::Policy>* __param_0) {
   return &__this->operator=(std::move(*__param_0));
-} extern "C" int
-__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEE9GetPolicyEv__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fcc() {
+} extern "C" inline __attribute__((used)) int
+__rust_thunk___ZN24template_template_params10MyTemplateINS_6PolicyEE9GetPolicyEv() {
   return template_template_params::MyTemplate<
       template_template_params::Policy>::GetPolicy();
 }
@@ -151,7 +151,7 @@ impl __CcTemplateInst10MyTemplateI8TopLevelE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: crate::TopLevel) {
-        crate::detail::__rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0_(__this,t)
     }
 }
 
@@ -193,7 +193,7 @@ impl __CcTemplateInst10MyTemplateIN23test_namespace_bindings5InnerEE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: crate::test_namespace_bindings::Inner) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1_(__this,t)
     }
 }
 
@@ -235,7 +235,7 @@ impl __CcTemplateInst10MyTemplateIS_I8TopLevelEE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: crate::__CcTemplateInst10MyTemplateI8TopLevelE) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1_(__this,t)
     }
 }
 
@@ -280,7 +280,7 @@ impl __CcTemplateInst10MyTemplateIS_IN23test_namespace_bindings5InnerEEE {
         __this: *mut Self,
         t: crate::__CcTemplateInst10MyTemplateIN23test_namespace_bindings5InnerEE,
     ) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2_(__this,t)
     }
 }
 
@@ -322,7 +322,7 @@ impl __CcTemplateInst10MyTemplateIbE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: bool) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIbE8processTEb__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIbE8processTEb(__this,t)
     }
 }
 
@@ -364,7 +364,7 @@ impl __CcTemplateInst10MyTemplateIcE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: u8) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIcE8processTEc__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIcE8processTEc(__this,t)
     }
 }
 
@@ -406,7 +406,7 @@ impl __CcTemplateInst10MyTemplateIdE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: f64) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIdE8processTEd__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIdE8processTEd(__this,t)
     }
 }
 
@@ -448,7 +448,7 @@ impl __CcTemplateInst10MyTemplateIfE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: f32) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIfE8processTEf__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIfE8processTEf(__this,t)
     }
 }
 
@@ -490,7 +490,7 @@ impl __CcTemplateInst10MyTemplateIiE {
     /// Generated from: rs_bindings_from_cc/test/golden/templates_source_order.h;l=13
     #[inline(always)]
     pub unsafe fn processT(__this: *mut Self, t: i32) {
-        crate::detail::__rust_thunk___ZN10MyTemplateIiE8processTEi__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(__this,t)
+        crate::detail::__rust_thunk___ZN10MyTemplateIiE8processTEi(__this,t)
     }
 }
 
@@ -498,39 +498,39 @@ mod detail {
     #[allow(unused_imports)]
     use super::*;
     extern "C" {
-        pub(crate) fn __rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0_(
             __this: *mut crate::__CcTemplateInst10MyTemplateI8TopLevelE,
             t: crate::TopLevel,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1_(
             __this: *mut crate::__CcTemplateInst10MyTemplateIN23test_namespace_bindings5InnerEE,
             t: crate::test_namespace_bindings::Inner,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1_(
             __this: *mut crate::__CcTemplateInst10MyTemplateIS_I8TopLevelEE,
             t: crate::__CcTemplateInst10MyTemplateI8TopLevelE,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2_(
             __this: *mut crate::__CcTemplateInst10MyTemplateIS_IN23test_namespace_bindings5InnerEEE,
             t: crate::__CcTemplateInst10MyTemplateIN23test_namespace_bindings5InnerEE,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIbE8processTEb__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIbE8processTEb(
             __this: *mut crate::__CcTemplateInst10MyTemplateIbE,
             t: bool,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIcE8processTEc__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIcE8processTEc(
             __this: *mut crate::__CcTemplateInst10MyTemplateIcE,
             t: u8,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIdE8processTEd__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIdE8processTEd(
             __this: *mut crate::__CcTemplateInst10MyTemplateIdE,
             t: f64,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIfE8processTEf__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIfE8processTEf(
             __this: *mut crate::__CcTemplateInst10MyTemplateIfE,
             t: f32,
         );
-        pub(crate) fn __rust_thunk___ZN10MyTemplateIiE8processTEi__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+        pub(crate) fn __rust_thunk___ZN10MyTemplateIiE8processTEi(
             __this: *mut crate::__CcTemplateInst10MyTemplateIiE,
             t: i32,
         );
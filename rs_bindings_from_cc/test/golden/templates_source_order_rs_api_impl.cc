@@ -16,51 +16,51 @@
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wthread-safety-analysis"
-extern "C" void
-__rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateI8TopLevelE8processTES0_(
     class MyTemplate<TopLevel>* __this, struct TopLevel t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIN23test_namespace_bindings5InnerEE8processTES1_(
     class MyTemplate<test_namespace_bindings::Inner>* __this,
     struct test_namespace_bindings::Inner t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIS_I8TopLevelEE8processTES1_(
     class MyTemplate<MyTemplate<TopLevel>>* __this,
     class MyTemplate<TopLevel> t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2___2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIS_IN23test_namespace_bindings5InnerEEE8processTES2_(
     class MyTemplate<MyTemplate<test_namespace_bindings::Inner>>* __this,
     class MyTemplate<test_namespace_bindings::Inner> t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIbE8processTEb__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIbE8processTEb(
     class MyTemplate<bool>* __this, bool t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIcE8processTEc__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIcE8processTEc(
     class MyTemplate<char>* __this, char t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIdE8processTEd__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIdE8processTEd(
     class MyTemplate<double>* __this, double t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIfE8processTEf__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIfE8processTEf(
     class MyTemplate<float>* __this, float t) {
   __this->processT(t);
 }
-extern "C" void
-__rust_thunk___ZN10MyTemplateIiE8processTEi__2f_2fthird_5fparty_2fcrubit_2frs_5fbindings_5ffrom_5fcc_2ftest_2fgolden_3atemplates_5fsource_5forder_5fcc(
+extern "C" inline __attribute__((used)) void
+__rust_thunk___ZN10MyTemplateIiE8processTEi(
     class MyTemplate<int>* __this, int t) {
   __this->processT(t);
 }
@@ -0,0 +1,22 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "rs_bindings_from_cc/test/struct/bulk_thunks/bulk_thunks.h"
+
+static int next_value = 0;
+static int constructed_count = 0;
+static int destroyed_count = 0;
+
+Counted::Counted() : value_(next_value++) { ++constructed_count; }
+
+Counted::Counted(Counted&& other) : value_(other.value_) {
+  other.value_ = -1;
+  ++constructed_count;
+}
+
+Counted::~Counted() { ++destroyed_count; }
+
+int GetConstructedCount() { return constructed_count; }
+
+int GetDestroyedCount() { return destroyed_count; }
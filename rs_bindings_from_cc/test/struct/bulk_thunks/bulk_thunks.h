@@ -0,0 +1,34 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_BULK_THUNKS_BULK_THUNKS_H_
+#define CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_BULK_THUNKS_BULK_THUNKS_H_
+
+#pragma clang lifetime_elision
+
+// A !Unpin class that counts its constructions and destructions, and requests
+// bulk thunks, so that whole arrays of it can be constructed and destroyed by
+// Rust in a single call.
+class [[clang::annotate("crubit_bulk_thunks")]] Counted {
+ public:
+  // Each default-constructed object gets the next value of a global counter.
+  Counted();
+  // Leaves `other` with a value of -1.
+  Counted(Counted&& other);
+  ~Counted();
+
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+// Returns the number of `Counted` objects constructed so far (including
+// move-constructed ones).
+int GetConstructedCount();
+
+// Returns the number of `Counted` objects destroyed so far.
+int GetDestroyedCount();
+
+#endif  // CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_BULK_THUNKS_BULK_THUNKS_H_
@@ -0,0 +1,39 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#[cfg(test)]
+mod tests {
+    use bulk_thunks::*;
+    use ctor::PinnedArray;
+
+    // The counters in the C++ library are not thread-safe, so everything is
+    // tested sequentially, in a single test.
+    #[test]
+    fn test_arrays() {
+        let constructed = GetConstructedCount();
+        let destroyed = GetDestroyedCount();
+        {
+            let mut array = PinnedArray::<Counted>::new(1000);
+            assert_eq!(array.len(), 1000);
+            assert_eq!(GetConstructedCount(), constructed + 1000);
+            assert_eq!(array[999].value(), array[0].value() + 999);
+
+            let first_value = array[0].value();
+            let moved = PinnedArray::new_moved_from(array.as_mut());
+            assert_eq!(GetConstructedCount(), constructed + 2000);
+            assert_eq!(moved[0].value(), first_value);
+            assert_eq!(array[0].value(), -1);
+        }
+        assert_eq!(GetDestroyedCount(), destroyed + 2000);
+
+        {
+            ctor::emplace! {
+                let array = ctor::construct_array::<Counted, 4>();
+            }
+            assert_eq!(GetConstructedCount(), constructed + 2004);
+            assert_eq!(array[3].value(), array[0].value() + 3);
+        }
+        assert_eq!(GetDestroyedCount(), destroyed + 2004);
+    }
+}
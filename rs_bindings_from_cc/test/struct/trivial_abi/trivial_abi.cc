@@ -0,0 +1,22 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "rs_bindings_from_cc/test/struct/trivial_abi/trivial_abi.h"
+
+static int deleted_count = 0;
+
+UniqueIntPtr::~UniqueIntPtr() {
+  if (ptr != nullptr) {
+    delete ptr;
+    ++deleted_count;
+  }
+}
+
+UniqueIntPtr MakeUniqueIntPtr(int value) {
+  return UniqueIntPtr(new int(value));
+}
+
+int GetValue(const UniqueIntPtr& p) { return *p.ptr; }
+
+int GetDeletedCount() { return deleted_count; }
@@ -0,0 +1,28 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_TRIVIAL_ABI_TRIVIAL_ABI_H_
+#define CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_TRIVIAL_ABI_TRIVIAL_ABI_H_
+
+#pragma clang lifetime_elision
+
+// A `unique_ptr`-like class. It is !Unpin (because it isn't `final`), but it
+// is passed in registers (because of `[[clang::trivial_abi]]`), so functions
+// returning it by value can be called without a thunk.
+struct [[clang::trivial_abi]] UniqueIntPtr {
+  explicit UniqueIntPtr(int* ptr) : ptr(ptr) {}
+  UniqueIntPtr(UniqueIntPtr&& other) : ptr(other.ptr) { other.ptr = nullptr; }
+  ~UniqueIntPtr();
+
+  int* ptr;
+};
+
+UniqueIntPtr MakeUniqueIntPtr(int value);
+
+int GetValue(const UniqueIntPtr& p);
+
+// Returns the number of `int`s owned by `UniqueIntPtr`s that were deleted.
+int GetDeletedCount();
+
+#endif  // CRUBIT_RS_BINDINGS_FROM_CC_TEST_STRUCT_TRIVIAL_ABI_TRIVIAL_ABI_H_
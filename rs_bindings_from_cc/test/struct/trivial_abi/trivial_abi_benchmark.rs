@@ -0,0 +1,27 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+use std::time::Instant;
+use trivial_abi::*;
+
+const ITERATIONS: i32 = 10_000_000;
+
+fn main() {
+    let start = Instant::now();
+    let mut sum: i32 = 0;
+    for i in 0..ITERATIONS {
+        ctor::emplace! {
+            let p = MakeUniqueIntPtr(i);
+        }
+        sum = sum.wrapping_add(GetValue(&*p));
+    }
+    let elapsed = start.elapsed();
+    println!(
+        "{} calls in {:?} ({:.2} ns/call, checksum {})",
+        ITERATIONS,
+        elapsed,
+        elapsed.as_nanos() as f64 / ITERATIONS as f64,
+        sum
+    );
+}
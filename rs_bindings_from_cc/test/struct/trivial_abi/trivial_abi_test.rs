@@ -0,0 +1,22 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#[cfg(test)]
+mod tests {
+    use trivial_abi::*;
+
+    #[test]
+    fn test_return_by_value() {
+        let deleted_count = GetDeletedCount();
+        {
+            ctor::emplace! {
+                let p = MakeUniqueIntPtr(42);
+            }
+            assert_eq!(GetValue(&*p), 42);
+            assert_eq!(GetDeletedCount(), deleted_count);
+        }
+        // The returned value is owned (and destroyed) by Rust.
+        assert_eq!(GetDeletedCount(), deleted_count + 1);
+    }
+}
@@ -19,6 +19,9 @@ mod tests {
         assert_eq!(456, *s2.value());
     }
 
+    // Both `type_alias` and `type_alias_in_different_target` define the thunks
+    // for `MyTemplate<int>`. They have the same name in both targets and are
+    // deduplicated by the linker.
     #[test]
     fn test_alias_in_different_target_than_template() {
         let s = type_alias_in_different_target::TypeAliasInDifferentTarget::Create(789);
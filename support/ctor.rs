@@ -1162,6 +1162,235 @@ impl<T: Ctor> Ctor for ManuallyDropCtor<T> {
 
 impl<T: Ctor> !Unpin for ManuallyDropCtor<T> {}
 
+// ==================
+// Arrays of objects
+// ==================
+
+/// Types that can default-construct an array of objects in a single call.
+///
+/// Generated bindings for C++ classes implement this (along with `DestroyN`
+/// and `MoveConstructN`) with a single C++ thunk that loops over the array,
+/// rather than crossing the language boundary once per element.
+///
+/// # Safety
+///
+/// `construct_n` must initialize all `n` objects. If it panics instead, it must
+/// not leave any of them initialized: the objects it did initialize must be
+/// dropped, in reverse order. Rust implementations can use `construct_each`
+/// for this.
+pub unsafe trait ConstructN: Sized {
+    /// Default-constructs `n` objects, starting at `dest`.
+    ///
+    /// # Safety
+    ///
+    /// `dest` must be valid for writes of `n` objects and properly aligned.
+    unsafe fn construct_n(dest: *mut Self, n: usize);
+}
+
+/// Types that can destroy an array of objects in a single call.
+///
+/// # Safety
+///
+/// `destroy_n` must be equivalent to dropping each of the `n` objects.
+pub unsafe trait DestroyN: Sized {
+    /// Destroys `n` objects, starting at `ptr`.
+    ///
+    /// # Safety
+    ///
+    /// `ptr` must point to `n` initialized objects, which must not be used
+    /// afterwards.
+    unsafe fn destroy_n(ptr: *mut Self, n: usize);
+}
+
+/// Types that can move-construct an array of objects in a single call.
+///
+/// # Safety
+///
+/// `move_construct_n` must initialize all `n` objects at `dest`. If it panics
+/// instead, it must not leave any of them initialized, as for `ConstructN`.
+pub unsafe trait MoveConstructN: Sized {
+    /// Move-constructs `n` objects starting at `dest` from the `n` objects
+    /// starting at `src`. The objects at `src` are left in their moved-from
+    /// state, and still need to be destroyed.
+    ///
+    /// # Safety
+    ///
+    /// `dest` must be valid for writes of `n` objects, `src` must point to `n`
+    /// initialized objects, and the two ranges must not overlap.
+    unsafe fn move_construct_n(dest: *mut Self, src: *mut Self, n: usize);
+}
+
+/// Initializes the `n` objects starting at `dest` one at a time, by calling
+/// `init(i, dest.add(i))` for each index `i` in order.
+///
+/// If `init` panics, the objects that were already initialized are dropped in
+/// reverse order before the panic continues, so that none of the `n` objects is
+/// left initialized. This is how the `ConstructN` and `MoveConstructN` contracts
+/// can be upheld by implementations which construct one element at a time.
+///
+/// # Safety
+///
+/// `dest` must be valid for writes of `n` objects and properly aligned, and
+/// `init(i, ptr)` must initialize `*ptr` unless it panics.
+pub unsafe fn construct_each<T>(dest: *mut T, n: usize, mut init: impl FnMut(usize, *mut T)) {
+    /// Drops the initialized prefix of the array, unless forgotten.
+    struct PrefixGuard<T> {
+        dest: *mut T,
+        initialized: usize,
+    }
+    impl<T> Drop for PrefixGuard<T> {
+        fn drop(&mut self) {
+            for i in (0..self.initialized).rev() {
+                unsafe { std::ptr::drop_in_place(self.dest.add(i)) };
+            }
+        }
+    }
+
+    let mut guard = PrefixGuard { dest, initialized: 0 };
+    while guard.initialized < n {
+        init(guard.initialized, dest.add(guard.initialized));
+        guard.initialized += 1;
+    }
+    std::mem::forget(guard);
+}
+
+/// Returns a `Ctor` which default-constructs all the elements of an array with
+/// one call to `T::construct_n`.
+///
+/// If that call panics, `construct_n` has already dropped the elements it
+/// constructed (see `ConstructN`), so the array is left uninitialized and none
+/// of its elements is dropped twice.
+///
+/// ```
+/// emplace! { let pool = ctor::construct_array::<CxxClass, 1024>(); }
+/// ```
+pub fn construct_array<T: ConstructN, const N: usize>() -> impl Ctor<Output = [T; N]> {
+    FnCtor::new(|dest: Pin<&mut MaybeUninit<[T; N]>>| unsafe {
+        T::construct_n(Pin::into_inner_unchecked(dest).as_mut_ptr().cast::<T>(), N);
+    })
+}
+
+/// A fixed-size, heap-allocated array of pinned objects.
+///
+/// Unlike `Pin<Box<[T]>>`, the elements are constructed with a single call to
+/// `T::construct_n` (or `T::move_construct_n`), and destroyed with a single call
+/// to `T::destroy_n`.
+///
+/// The length is fixed: there is no growable counterpart, since growing would
+/// move the elements to a new allocation, and pinned objects must not move.
+pub struct PinnedArray<T: DestroyN> {
+    ptr: std::ptr::NonNull<T>,
+    len: usize,
+    _marker: PhantomData<T>,
+}
+
+/// The allocation behind a `PinnedArray`, which is freed without destroying
+/// any objects if constructing them panics.
+struct PinnedArrayStorage<T> {
+    ptr: std::ptr::NonNull<T>,
+    len: usize,
+}
+
+impl<T> PinnedArrayStorage<T> {
+    /// Allocates uninitialized storage for `len` objects.
+    fn allocate(len: usize) -> Self {
+        let layout = std::alloc::Layout::array::<T>(len).expect("PinnedArray is too large");
+        let ptr = if layout.size() == 0 {
+            std::ptr::NonNull::dangling()
+        } else {
+            let ptr = unsafe { std::alloc::alloc(layout) }.cast::<T>();
+            std::ptr::NonNull::new(ptr).unwrap_or_else(|| std::alloc::handle_alloc_error(layout))
+        };
+        PinnedArrayStorage { ptr, len }
+    }
+
+    /// Hands the storage over to a `PinnedArray`.
+    ///
+    /// # Safety
+    ///
+    /// All `len` objects must be initialized.
+    unsafe fn assume_init(self) -> PinnedArray<T>
+    where
+        T: DestroyN,
+    {
+        let array = PinnedArray { ptr: self.ptr, len: self.len, _marker: PhantomData };
+        std::mem::forget(self);
+        array
+    }
+}
+
+impl<T> Drop for PinnedArrayStorage<T> {
+    fn drop(&mut self) {
+        let layout = std::alloc::Layout::array::<T>(self.len).unwrap();
+        if layout.size() != 0 {
+            unsafe { std::alloc::dealloc(self.ptr.as_ptr().cast::<u8>(), layout) };
+        }
+    }
+}
+
+impl<T: DestroyN> PinnedArray<T> {
+    /// Creates an array of `len` default-constructed objects.
+    pub fn new(len: usize) -> Self
+    where
+        T: ConstructN,
+    {
+        let storage = PinnedArrayStorage::allocate(len);
+        unsafe {
+            T::construct_n(storage.ptr.as_ptr(), len);
+            storage.assume_init()
+        }
+    }
+
+    /// Creates an array of objects move-constructed from the elements of
+    /// `src`, which are left in their moved-from state.
+    pub fn new_moved_from(src: Pin<&mut [T]>) -> Self
+    where
+        T: MoveConstructN,
+    {
+        let storage = PinnedArrayStorage::allocate(src.len());
+        unsafe {
+            let src = Pin::into_inner_unchecked(src);
+            T::move_construct_n(storage.ptr.as_ptr(), src.as_mut_ptr(), src.len());
+            storage.assume_init()
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns a pinned mutable reference to the elements.
+    pub fn as_mut(&mut self) -> Pin<&mut [T]> {
+        unsafe { Pin::new_unchecked(std::slice::from_raw_parts_mut(self.ptr.as_ptr(), self.len)) }
+    }
+
+    /// Returns a pinned mutable reference to the element at `index`.
+    ///
+    /// Panics if `index` is out of bounds.
+    pub fn index_mut(&mut self, index: usize) -> Pin<&mut T> {
+        unsafe { self.as_mut().map_unchecked_mut(|elements| &mut elements[index]) }
+    }
+}
+
+impl<T: DestroyN> Deref for PinnedArray<T> {
+    type Target = [T];
+    fn deref(&self) -> &[T] {
+        unsafe { std::slice::from_raw_parts(self.ptr.as_ptr(), self.len) }
+    }
+}
+
+impl<T: DestroyN> Drop for PinnedArray<T> {
+    fn drop(&mut self) {
+        let storage = PinnedArrayStorage { ptr: self.ptr, len: self.len };
+        unsafe { T::destroy_n(self.ptr.as_ptr(), self.len) };
+        drop(storage);
+    }
+}
+
 /// A utility trait to add lifetime bounds to an `impl Ctor`.
 ///
 /// When returning trait impls, captures don't work as one would expect;
@@ -1718,4 +1947,159 @@ mod test {
     //     assert_eq!(*sum, 42);
     // }
     // ```
+
+    /// A Rust type that counts how often the bulk operations were called.
+    struct BulkCounted {
+        value: i32,
+    }
+    impl !Unpin for BulkCounted {}
+
+    thread_local! {
+        static BULK_LOG: RefCell<Vec<String>> = RefCell::new(vec![]);
+    }
+
+    fn bulk_log() -> Vec<String> {
+        BULK_LOG.with(|log| log.borrow().clone())
+    }
+
+    unsafe impl ConstructN for BulkCounted {
+        unsafe fn construct_n(dest: *mut Self, n: usize) {
+            BULK_LOG.with(|log| log.borrow_mut().push(format!("construct_n({n})")));
+            for i in 0..n {
+                dest.add(i).write(BulkCounted { value: i as i32 });
+            }
+        }
+    }
+
+    unsafe impl DestroyN for BulkCounted {
+        unsafe fn destroy_n(ptr: *mut Self, n: usize) {
+            BULK_LOG.with(|log| log.borrow_mut().push(format!("destroy_n({n})")));
+            for i in 0..n {
+                std::ptr::drop_in_place(ptr.add(i));
+            }
+        }
+    }
+
+    unsafe impl MoveConstructN for BulkCounted {
+        unsafe fn move_construct_n(dest: *mut Self, src: *mut Self, n: usize) {
+            BULK_LOG.with(|log| log.borrow_mut().push(format!("move_construct_n({n})")));
+            for i in 0..n {
+                let src = &mut *src.add(i);
+                dest.add(i).write(BulkCounted { value: src.value });
+                src.value = -1;
+            }
+        }
+    }
+
+    #[test]
+    fn test_construct_array() {
+        BULK_LOG.with(|log| log.borrow_mut().clear());
+        emplace! {let x = construct_array::<BulkCounted, 4>();}
+        assert_eq!(x.iter().map(|e| e.value).collect::<Vec<_>>(), vec![0, 1, 2, 3]);
+        assert_eq!(bulk_log(), vec!["construct_n(4)"]);
+    }
+
+    #[test]
+    fn test_pinned_array() {
+        BULK_LOG.with(|log| log.borrow_mut().clear());
+        {
+            let mut array = PinnedArray::<BulkCounted>::new(1000);
+            assert_eq!(array.len(), 1000);
+            assert_eq!(array[999].value, 999);
+            unsafe { array.index_mut(1).get_unchecked_mut() }.value = 42;
+            assert_eq!(array[1].value, 42);
+        }
+        assert_eq!(bulk_log(), vec!["construct_n(1000)", "destroy_n(1000)"]);
+    }
+
+    #[test]
+    fn test_pinned_array_moved_from() {
+        BULK_LOG.with(|log| log.borrow_mut().clear());
+        {
+            let mut src = PinnedArray::<BulkCounted>::new(3);
+            let moved = PinnedArray::new_moved_from(src.as_mut());
+            assert_eq!(moved.iter().map(|e| e.value).collect::<Vec<_>>(), vec![0, 1, 2]);
+            assert_eq!(src.iter().map(|e| e.value).collect::<Vec<_>>(), vec![-1, -1, -1]);
+        }
+        assert_eq!(
+            bulk_log(),
+            vec!["construct_n(3)", "move_construct_n(3)", "destroy_n(3)", "destroy_n(3)"]
+        );
+    }
+
+    /// A Rust type whose `construct_n` panics when constructing the element at
+    /// index `PANIC_AT`.
+    struct PanicAt {
+        index: usize,
+    }
+    impl !Unpin for PanicAt {}
+
+    const PANIC_AT: usize = 3;
+
+    thread_local! {
+        static DROPPED: RefCell<Vec<usize>> = RefCell::new(vec![]);
+    }
+
+    impl Drop for PanicAt {
+        fn drop(&mut self) {
+            DROPPED.with(|dropped| dropped.borrow_mut().push(self.index));
+        }
+    }
+
+    unsafe impl ConstructN for PanicAt {
+        unsafe fn construct_n(dest: *mut Self, n: usize) {
+            construct_each(dest, n, |index, dest| {
+                if index == PANIC_AT {
+                    panic!("constructor {index} failed");
+                }
+                dest.write(PanicAt { index });
+            });
+        }
+    }
+
+    unsafe impl DestroyN for PanicAt {
+        unsafe fn destroy_n(ptr: *mut Self, n: usize) {
+            for i in 0..n {
+                std::ptr::drop_in_place(ptr.add(i));
+            }
+        }
+    }
+
+    /// Tests that when a constructor panics, only the elements constructed
+    /// before it are dropped, in reverse order.
+    #[test]
+    fn test_construct_array_drops_initialized_prefix_on_panic() {
+        DROPPED.with(|dropped| dropped.borrow_mut().clear());
+        let panic_result = std::panic::catch_unwind(|| {
+            emplace! {let _x = construct_array::<PanicAt, 5>();}
+        });
+        assert!(panic_result.is_err());
+        assert_eq!(DROPPED.with(|dropped| dropped.borrow().clone()), vec![2, 1, 0]);
+    }
+
+    #[test]
+    fn test_pinned_array_drops_initialized_prefix_on_panic() {
+        DROPPED.with(|dropped| dropped.borrow_mut().clear());
+        let panic_result = std::panic::catch_unwind(|| PinnedArray::<PanicAt>::new(5));
+        assert!(panic_result.is_err());
+        assert_eq!(DROPPED.with(|dropped| dropped.borrow().clone()), vec![2, 1, 0]);
+    }
+
+    #[test]
+    fn test_construct_each_without_panic() {
+        DROPPED.with(|dropped| dropped.borrow_mut().clear());
+        {
+            let array = PinnedArray::<PanicAt>::new(PANIC_AT);
+            assert_eq!(array.iter().map(|e| e.index).collect::<Vec<_>>(), vec![0, 1, 2]);
+            assert_eq!(DROPPED.with(|dropped| dropped.borrow().len()), 0);
+        }
+        assert_eq!(DROPPED.with(|dropped| dropped.borrow().clone()), vec![0, 1, 2]);
+    }
+
+    #[test]
+    fn test_empty_pinned_array() {
+        let array = PinnedArray::<BulkCounted>::new(0);
+        assert!(array.is_empty());
+        assert_eq!(array.len(), 0);
+    }
 }
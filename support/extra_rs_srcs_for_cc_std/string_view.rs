@@ -8,10 +8,12 @@ use std::ptr;
 
 impl From<string_view> for *const [u8] {
     fn from(sv: string_view) -> Self {
-        let mut data = unsafe { string_view::data(&sv) };
-        // TODO(b/249376862): use size.
-        // let size = unsafe {string_view::size(&sv)};
-        let size = unsafe { string_view::end(&sv) as usize - string_view::begin(&sv) as usize };
+        // The fields are read directly (rather than by calling the `data()` and
+        // `size()` bindings, which would go through out-of-line thunks because
+        // the methods are inline). Their offsets are checked by the layout
+        // assertions of the generated bindings, and their sizes by `transmute`.
+        let mut data: *const u8 = unsafe { std::mem::transmute(sv.__data_) };
+        let size: usize = unsafe { std::mem::transmute(sv.__size_) };
         // Unlike C++, Rust does not allow for null data pointers in slices.
         if data.is_null() {
             data = ptr::NonNull::dangling().as_ptr();
@@ -0,0 +1,44 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef CRUBIT_RS_BINDINGS_FROM_CC_SUPPORT_LAYOUT_ASSERTIONS_H_
+#define CRUBIT_RS_BINDINGS_FROM_CC_SUPPORT_LAYOUT_ASSERTIONS_H_
+
+#include <cstddef>
+
+namespace crubit::details {
+
+// A single layout property (e.g. `sizeof`, `alignof` or `CRUBIT_OFFSET_OF` of
+// a record) together with the value that the generated Rust bindings expect.
+//
+// With `--compact_layout_assertions` the generated `rs_api_impl.cc` verifies
+// all the layout properties of a target with a single `static_assert` over a
+// table of `LayoutCheck`s, instead of with one `static_assert` per property.
+struct LayoutCheck {
+  std::size_t actual;
+  std::size_t expected;
+};
+
+// Returns the index of the first check in `checks` whose `actual` value is
+// different from its `expected` value, or `N` if all the checks pass.
+//
+// Returning the index (rather than a `bool`) means that Clang's diagnostic for
+// a failing `static_assert(FirstFailedLayoutCheck(t) == LayoutCheckCount(t))`
+// points at the offending row of the table.
+template <std::size_t N>
+constexpr std::size_t FirstFailedLayoutCheck(const LayoutCheck (&checks)[N]) {
+  for (std::size_t i = 0; i < N; ++i) {
+    if (checks[i].actual != checks[i].expected) return i;
+  }
+  return N;
+}
+
+template <std::size_t N>
+constexpr std::size_t LayoutCheckCount(const LayoutCheck (&)[N]) {
+  return N;
+}
+
+}  // namespace crubit::details
+
+#endif  // CRUBIT_RS_BINDINGS_FROM_CC_SUPPORT_LAYOUT_ASSERTIONS_H_
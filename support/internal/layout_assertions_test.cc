@@ -0,0 +1,42 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "support/internal/layout_assertions.h"
+
+#include <stdint.h>
+
+#include "support/internal/offsetof.h"
+
+namespace crubit {
+namespace {
+
+using ::crubit::details::FirstFailedLayoutCheck;
+using ::crubit::details::LayoutCheck;
+using ::crubit::details::LayoutCheckCount;
+
+struct BasicStruct {
+  int64_t offset0;
+  int32_t offset8;
+};
+
+constexpr LayoutCheck kPassingChecks[] = {
+    {sizeof(BasicStruct), 16},
+    {alignof(BasicStruct), 8},
+    {CRUBIT_OFFSET_OF(offset0, BasicStruct), 0},
+    {CRUBIT_OFFSET_OF(offset8, BasicStruct), 8},
+};
+static_assert(LayoutCheckCount(kPassingChecks) == 4, "");
+static_assert(FirstFailedLayoutCheck(kPassingChecks) ==
+                  LayoutCheckCount(kPassingChecks),
+              "");
+
+constexpr LayoutCheck kFailingChecks[] = {
+    {sizeof(BasicStruct), 16},
+    {CRUBIT_OFFSET_OF(offset8, BasicStruct), 12},
+    {alignof(BasicStruct), 4},
+};
+static_assert(FirstFailedLayoutCheck(kFailingChecks) == 1, "");
+
+}  // namespace
+}  // namespace crubit
@@ -0,0 +1,196 @@
+// Part of the Crubit project, under the Apache License v2.0 with LLVM
+// Exceptions. See /LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//! # Slice views shared with C++.
+//!
+//! `SliceRef<T>` and `SliceMut<T>` have the same layout as C++ contiguous
+//! views such as `absl::Span<const T>` / `absl::Span<T>` and
+//! `std::span<T>` (with a dynamic extent): a pointer to the first element,
+//! followed by the number of elements. They are passed to and returned from
+//! C++ functions by value, without copying the elements.
+//!
+//! Rust slices (`&[T]`) are not FFI-safe, and C++ views don't carry lifetimes,
+//! so converting a view back into a Rust slice is `unsafe`:
+//!
+//! ```ignore
+//! let values = [1.0, 2.0, 3.0];
+//! let sum = unsafe { Sum(SliceRef::from(&values[..])) };
+//! ```
+
+use std::marker::PhantomData;
+
+/// A read-only view of a contiguous sequence of `T`s, with the layout of
+/// `absl::Span<const T>`.
+#[repr(C)]
+pub struct SliceRef<T> {
+    ptr: *const T,
+    len: usize,
+    _marker: PhantomData<*const [T]>,
+}
+
+/// A mutable view of a contiguous sequence of `T`s, with the layout of
+/// `absl::Span<T>`.
+#[repr(C)]
+pub struct SliceMut<T> {
+    ptr: *mut T,
+    len: usize,
+    _marker: PhantomData<*mut [T]>,
+}
+
+impl<T> SliceRef<T> {
+    /// Creates a view of `len` elements starting at `ptr`.
+    pub const fn from_raw_parts(ptr: *const T, len: usize) -> Self {
+        SliceRef { ptr, len, _marker: PhantomData }
+    }
+
+    pub const fn as_ptr(&self) -> *const T {
+        self.ptr
+    }
+
+    pub const fn len(&self) -> usize {
+        self.len
+    }
+
+    pub const fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns the viewed elements as a Rust slice.
+    ///
+    /// # Safety
+    ///
+    /// The behavior is undefined unless the view refers to `len()` initialized
+    /// elements (or is empty) that stay alive and are not mutated during `'a`.
+    pub unsafe fn as_slice<'a>(&self) -> &'a [T] {
+        if self.len == 0 {
+            // C++ views may use a null pointer for empty sequences, but Rust
+            // slices must not.
+            return &[];
+        }
+        std::slice::from_raw_parts(self.ptr, self.len)
+    }
+}
+
+impl<T> SliceMut<T> {
+    /// Creates a view of `len` elements starting at `ptr`.
+    pub const fn from_raw_parts(ptr: *mut T, len: usize) -> Self {
+        SliceMut { ptr, len, _marker: PhantomData }
+    }
+
+    pub const fn as_mut_ptr(&self) -> *mut T {
+        self.ptr
+    }
+
+    pub const fn len(&self) -> usize {
+        self.len
+    }
+
+    pub const fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns the viewed elements as a mutable Rust slice.
+    ///
+    /// # Safety
+    ///
+    /// The behavior is undefined unless the view refers to `len()` initialized
+    /// elements (or is empty) that stay alive and are not otherwise accessed
+    /// during `'a`.
+    pub unsafe fn as_mut_slice<'a>(&self) -> &'a mut [T] {
+        if self.len == 0 {
+            return &mut [];
+        }
+        std::slice::from_raw_parts_mut(self.ptr, self.len)
+    }
+}
+
+// The views are plain pointer+length pairs, regardless of whether `T` is
+// `Copy`.
+impl<T> Clone for SliceRef<T> {
+    fn clone(&self) -> Self {
+        *self
+    }
+}
+impl<T> Copy for SliceRef<T> {}
+impl<T> Clone for SliceMut<T> {
+    fn clone(&self) -> Self {
+        *self
+    }
+}
+impl<T> Copy for SliceMut<T> {}
+
+impl<T> std::fmt::Debug for SliceRef<T> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("SliceRef").field("ptr", &self.ptr).field("len", &self.len).finish()
+    }
+}
+
+impl<T> std::fmt::Debug for SliceMut<T> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("SliceMut").field("ptr", &self.ptr).field("len", &self.len).finish()
+    }
+}
+
+impl<'a, T> From<&'a [T]> for SliceRef<T> {
+    fn from(slice: &'a [T]) -> Self {
+        SliceRef::from_raw_parts(slice.as_ptr(), slice.len())
+    }
+}
+
+impl<'a, T> From<&'a mut [T]> for SliceRef<T> {
+    fn from(slice: &'a mut [T]) -> Self {
+        SliceRef::from_raw_parts(slice.as_ptr(), slice.len())
+    }
+}
+
+impl<'a, T> From<&'a mut [T]> for SliceMut<T> {
+    fn from(slice: &'a mut [T]) -> Self {
+        SliceMut::from_raw_parts(slice.as_mut_ptr(), slice.len())
+    }
+}
+
+impl<T> From<SliceMut<T>> for SliceRef<T> {
+    fn from(slice: SliceMut<T>) -> Self {
+        SliceRef::from_raw_parts(slice.ptr, slice.len)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_layout() {
+        assert_eq!(std::mem::size_of::<SliceRef<u8>>(), 2 * std::mem::size_of::<usize>());
+        assert_eq!(std::mem::size_of::<SliceMut<u8>>(), 2 * std::mem::size_of::<usize>());
+        assert_eq!(memoffset::offset_of!(SliceRef<u8>, len), std::mem::size_of::<usize>());
+    }
+
+    #[test]
+    fn test_round_trip() {
+        let values = [1, 2, 3];
+        let view = SliceRef::from(&values[..]);
+        assert_eq!(view.len(), 3);
+        assert_eq!(view.as_ptr(), values.as_ptr());
+        assert_eq!(unsafe { view.as_slice() }, &[1, 2, 3]);
+    }
+
+    #[test]
+    fn test_mut_round_trip() {
+        let mut values = [1, 2, 3];
+        let view = SliceMut::from(&mut values[..]);
+        let slice = unsafe { view.as_mut_slice() };
+        slice[1] = 20;
+        assert_eq!(values, [1, 20, 3]);
+    }
+
+    #[test]
+    fn test_null_empty() {
+        let view = SliceRef::<i32>::from_raw_parts(std::ptr::null(), 0);
+        assert!(view.is_empty());
+        assert_eq!(unsafe { view.as_slice() }, &[] as &[i32]);
+        let view = SliceMut::<i32>::from_raw_parts(std::ptr::null_mut(), 0);
+        assert_eq!(unsafe { view.as_mut_slice() }, &mut [] as &mut [i32]);
+    }
+}